@@ -70,7 +70,7 @@ App::~App()
 {
 }
 
-void App::Startup(char*)
+void App::Startup(char* commandLineString)
 {
     using namespace enigma::resource;
 
@@ -200,7 +200,19 @@ void App::Startup(char*)
     GEngine->Startup();
     g_theLogger->SetGlobalLogLevel(LogLevel::INFO);
 
-    g_theGame = new Game();
+    CommandLineRequest pregeneration = WorldPregenerator::ParseCommandLine(commandLineString, m_pregenerationRequest);
+    CommandLineRequest benchmark     = WorldGenBenchmark::ParseCommandLine(commandLineString, m_benchmarkRequest);
+    m_isPregenerating                = pregeneration == CommandLineRequest::Valid;
+    m_isBenchmarking                 = benchmark == CommandLineRequest::Valid;
+    if (pregeneration == CommandLineRequest::Invalid || benchmark == CommandLineRequest::Invalid)
+    {
+        // A rejected run mode must not fall back to the interactive game (the reason is already logged)
+        HandleQuitRequested(true);
+    }
+    else
+    {
+        g_theGame = new Game(m_isPregenerating ? &m_pregenerationRequest : nullptr, m_isBenchmarking ? &m_benchmarkRequest : nullptr);
+    }
 
     g_rng = new RandomNumberGenerator();
 }
@@ -262,9 +274,10 @@ bool App::IsQuitting() const
     return m_isQuitting;
 }
 
-void App::HandleQuitRequested()
+void App::HandleQuitRequested(bool failed)
 {
-    m_isQuitting = true;
+    m_isQuitting      = true;
+    m_quitWithFailure = m_quitWithFailure || failed;
 }
 
 void App::HandleKeyBoardEvent()
@@ -456,7 +469,7 @@ void App::EndFrame()
     {
         delete g_theGame;
         g_theGame = nullptr;
-        g_theGame = new Game();
+        g_theGame = new Game(m_isPregenerating ? &m_pregenerationRequest : nullptr, m_isBenchmarking ? &m_benchmarkRequest : nullptr);
         // Restore state
         m_isPendingRestart = false;
         m_isPaused         = false;
@@ -2,6 +2,8 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Core/Yaml.hpp"
+#include "Game/Gameplay/Generator/WorldGenBenchmark.hpp"
+#include "Game/Gameplay/Generator/WorldPregenerator.hpp"
 
 class Window;
 class Game;
@@ -28,7 +30,8 @@ public:
     void RunFrame();
 
     bool IsQuitting() const;
-    void HandleQuitRequested();
+    void HandleQuitRequested(bool failed = false);
+    int  GetExitCode() const { return m_quitWithFailure ? 1 : 0; }
 
     void AdjustForPauseAndTimeDistortion();
     void HandleKeyBoardEvent();
@@ -52,9 +55,18 @@ public:
     bool  m_isSlowMo         = false;
     bool  m_isDebug          = false;
     bool  m_isPendingRestart = false;
+    bool  m_quitWithFailure  = false; // Invalid command line or failed benchmark / pregeneration run
     Rgba8 m_backgroundColor  = Rgba8(63, 63, 63, 255);
 
     AABB2 m_consoleSpace;
 
+    // Pregeneration run requested on the command line (the game quits when it completes)
+    bool                 m_isPregenerating = false;
+    PregenerationRequest m_pregenerationRequest;
+
+    // Generator benchmark requested on the command line (runs during Game construction, then quits)
+    bool                     m_isBenchmarking = false;
+    WorldGenBenchmarkRequest m_benchmarkRequest;
+
     STATIC bool WindowCloseEvent(EventArgs& args);
 };
@@ -0,0 +1,176 @@
+#include "WorldGenConfigParser.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+using namespace enigma::core;
+
+WorldGenConfig WorldGenConfigParser::LoadFromYaml(const std::string& yamlPath)
+{
+    WorldGenConfig config;
+
+    try
+    {
+        auto yamlConfig = YamlConfiguration::LoadFromFile(yamlPath);
+
+        DebuggerPrintf("Loading world generation config from: %s\n", yamlPath.c_str());
+
+        // Parse noise cell parameters
+        config.m_useNoiseCells     = yamlConfig.GetBoolean("worldgen.noiseCells.enabled", false);
+        config.m_noiseCellSizeXY   = yamlConfig.GetInt("worldgen.noiseCells.sizeXY", 4);
+        config.m_noiseCellSizeZ    = yamlConfig.GetInt("worldgen.noiseCells.sizeZ", 8);
+        config.m_compareNoiseCells = yamlConfig.GetBoolean("worldgen.noiseCells.compare", false);
+
+        // Parse batch noise parameters
+        config.m_useBatchNoise  = yamlConfig.GetBoolean("worldgen.batchNoise.enabled", false);
+        config.m_batchNoiseSimd = yamlConfig.GetString("worldgen.batchNoise.simd", "auto");
+        config.m_batchNoiseFixed = yamlConfig.GetBoolean("worldgen.batchNoise.fixedKernel", true);
+
+        // Parse noise backend parameters
+        config.m_noiseBackend   = yamlConfig.GetString("worldgen.noise.backend", "classic");
+        config.m_noiseBenchmark = yamlConfig.GetBoolean("worldgen.noise.benchmark", false);
+
+        // Parse height band culling parameters
+        config.m_useHeightBandCulling = yamlConfig.GetBoolean("worldgen.heightBand.enabled", true);
+        config.m_densityNoiseBound    = yamlConfig.GetFloat("worldgen.heightBand.noiseBound", 1.0f);
+
+        // Parse climate tile cache parameters
+        config.m_useClimateCache      = yamlConfig.GetBoolean("worldgen.climateCache.enabled", true);
+        config.m_climateCacheMaxTiles = yamlConfig.GetInt("worldgen.climateCache.maxTiles", 1024);
+
+        // Parse heightmap service parameters
+        config.m_heightmapGeneratedTiles = yamlConfig.GetInt("worldgen.heightmap.generatedTiles", 4096);
+        config.m_heightmapEstimatedTiles = yamlConfig.GetInt("worldgen.heightmap.estimatedTiles", 1024);
+
+        // Parse spline lookup table parameters
+        config.m_useSplineLut        = yamlConfig.GetBoolean("worldgen.splineLut.enabled", false);
+        config.m_splineLutResolution = yamlConfig.GetInt("worldgen.splineLut.resolution", 2048);
+        config.m_splineLutTolerance  = yamlConfig.GetFloat("worldgen.splineLut.tolerance", 1.0e-4f);
+
+        // Parse tree placement parameters
+        config.m_treePlacement        = yamlConfig.GetString("worldgen.trees.placement", "noise");
+        config.m_treeGridCellSize     = yamlConfig.GetInt("worldgen.trees.gridCellSize", 6);
+        config.m_compareTreePlacement = yamlConfig.GetBoolean("worldgen.trees.compare", false);
+
+        // Parse generation pipeline parameters
+        config.m_logStageTimings = yamlConfig.GetBoolean("worldgen.pipeline.stageTimings", false);
+
+        // Parse feature parameters
+        config.m_useOreVeins = yamlConfig.GetBoolean("worldgen.features.ores", true);
+        config.m_useCaves    = yamlConfig.GetBoolean("worldgen.features.caves", true);
+
+        DebuggerPrintf("Parsed world generation config:\n");
+        DebuggerPrintf("  Noise Cells: %s\n", config.m_useNoiseCells ? "true" : "false");
+        DebuggerPrintf("  Noise Cell Size: %dx%dx%d\n", config.m_noiseCellSizeXY, config.m_noiseCellSizeXY, config.m_noiseCellSizeZ);
+        DebuggerPrintf("  Noise Cell Compare: %s\n", config.m_compareNoiseCells ? "true" : "false");
+        DebuggerPrintf("  Batch Noise: %s (simd: %s, fixed kernel: %s)\n", config.m_useBatchNoise ? "true" : "false",
+                       config.m_batchNoiseSimd.c_str(), config.m_batchNoiseFixed ? "true" : "false");
+        DebuggerPrintf("  Noise Backend: %s (benchmark: %s)\n", config.m_noiseBackend.c_str(), config.m_noiseBenchmark ? "true" : "false");
+        DebuggerPrintf("  Height Band Culling: %s (noise bound: %f)\n", config.m_useHeightBandCulling ? "true" : "false", config.m_densityNoiseBound);
+        DebuggerPrintf("  Climate Cache: %s (max tiles: %d)\n", config.m_useClimateCache ? "true" : "false", config.m_climateCacheMaxTiles);
+        DebuggerPrintf("  Heightmap Tiles: %d generated, %d estimated\n", config.m_heightmapGeneratedTiles, config.m_heightmapEstimatedTiles);
+        DebuggerPrintf("  Spline LUT: %s (resolution: %d, tolerance: %g)\n", config.m_useSplineLut ? "true" : "false",
+                       config.m_splineLutResolution, config.m_splineLutTolerance);
+        DebuggerPrintf("  Tree Placement: %s (grid cell: %d, compare: %s)\n", config.m_treePlacement.c_str(),
+                       config.m_treeGridCellSize, config.m_compareTreePlacement ? "true" : "false");
+        DebuggerPrintf("  Pipeline Stage Timings: %s\n", config.m_logStageTimings ? "true" : "false");
+        DebuggerPrintf("  Ore Veins: %s\n", config.m_useOreVeins ? "true" : "false");
+        DebuggerPrintf("  Caves: %s\n", config.m_useCaves ? "true" : "false");
+
+        // Validate configuration
+        if (!ValidateConfig(config))
+        {
+            DebuggerPrintf("Warning: Invalid world generation configuration detected, using defaults\n");
+            config = WorldGenConfig();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        DebuggerPrintf("Error loading world generation config from %s: %s\n", yamlPath.c_str(), e.what());
+        DebuggerPrintf("Using default world generation configuration\n");
+        // Use default values (already set in struct)
+    }
+
+    return config;
+}
+
+bool WorldGenConfigParser::ValidateConfig(const WorldGenConfig& config)
+{
+    // Validate noise cell size (must be positive and no larger than a chunk)
+    if (config.m_noiseCellSizeXY < 1 || config.m_noiseCellSizeXY > 16)
+    {
+        DebuggerPrintf("Invalid noise cell size XY: %d (expected 1-16)\n", config.m_noiseCellSizeXY);
+        return false;
+    }
+
+    if (config.m_noiseCellSizeZ < 1 || config.m_noiseCellSizeZ > 64)
+    {
+        DebuggerPrintf("Invalid noise cell size Z: %d (expected 1-64)\n", config.m_noiseCellSizeZ);
+        return false;
+    }
+
+    // Validate density noise bound (culling is only exact if the bound covers the real noise range)
+    if (config.m_densityNoiseBound < 1.0f || config.m_densityNoiseBound > 4.0f)
+    {
+        DebuggerPrintf("Invalid density noise bound: %f (expected 1.0-4.0)\n", config.m_densityNoiseBound);
+        return false;
+    }
+
+    // Validate climate cache capacity
+    if (config.m_climateCacheMaxTiles < 16 || config.m_climateCacheMaxTiles > 65536)
+    {
+        DebuggerPrintf("Invalid climate cache max tiles: %d (expected 16-65536)\n", config.m_climateCacheMaxTiles);
+        return false;
+    }
+
+    // Validate heightmap service capacities
+    if (config.m_heightmapGeneratedTiles < 16 || config.m_heightmapGeneratedTiles > 65536 ||
+        config.m_heightmapEstimatedTiles < 16 || config.m_heightmapEstimatedTiles > 65536)
+    {
+        DebuggerPrintf("Invalid heightmap tiles: %d generated, %d estimated (expected 16-65536)\n",
+                       config.m_heightmapGeneratedTiles, config.m_heightmapEstimatedTiles);
+        return false;
+    }
+
+    // Validate spline lookup tables
+    if (config.m_splineLutResolution < 16 || config.m_splineLutResolution > 65536)
+    {
+        DebuggerPrintf("Invalid spline LUT resolution: %d (expected 16-65536)\n", config.m_splineLutResolution);
+        return false;
+    }
+
+    if (config.m_splineLutTolerance <= 0.0f || config.m_splineLutTolerance > 0.1f)
+    {
+        DebuggerPrintf("Invalid spline LUT tolerance: %f (expected (0, 0.1])\n", config.m_splineLutTolerance);
+        return false;
+    }
+
+    // Validate batch noise instruction set
+    if (config.m_batchNoiseSimd != "auto" && config.m_batchNoiseSimd != "avx2" &&
+        config.m_batchNoiseSimd != "sse4.1" && config.m_batchNoiseSimd != "scalar")
+    {
+        DebuggerPrintf("Invalid batch noise simd: %s (expected auto, avx2, sse4.1 or scalar)\n", config.m_batchNoiseSimd.c_str());
+        return false;
+    }
+
+    if (config.m_noiseBackend != "classic" && config.m_noiseBackend != "perlin" &&
+        config.m_noiseBackend != "opensimplex2" && config.m_noiseBackend != "valuegradient")
+    {
+        DebuggerPrintf("Invalid noise backend: %s (expected classic, perlin, opensimplex2 or valuegradient)\n", config.m_noiseBackend.c_str());
+        return false;
+    }
+
+    // Validate tree placement
+    if (config.m_treePlacement != "noise" && config.m_treePlacement != "grid")
+    {
+        DebuggerPrintf("Invalid tree placement: %s (expected noise or grid)\n", config.m_treePlacement.c_str());
+        return false;
+    }
+
+    if (config.m_treeGridCellSize < 3 || config.m_treeGridCellSize > 32)
+    {
+        DebuggerPrintf("Invalid tree grid cell size: %d (expected 3-32)\n", config.m_treeGridCellSize);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,85 @@
+#pragma once
+#include <string>
+
+//-----------------------------------------------------------------------------------------------
+// WorldGenConfigParser.hpp
+// Loads and validates world generation tuning parameters from YAML files.
+//-----------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------
+// WorldGenConfig - Terrain generator tuning parameters for SimpleMinerGenerator
+// All parameters have sensible defaults, loaded from settings.yml if available
+//-----------------------------------------------------------------------------------------------
+struct WorldGenConfig
+{
+    // Noise cell mode: sample the 3D density noise on a coarse lattice and trilinearly
+    // interpolate the voxels in between (Minecraft style 4x4x8 cells)
+    bool m_useNoiseCells     = false; // Enable coarse-lattice density interpolation
+    int  m_noiseCellSizeXY   = 4; // Cell width along X and Y (blocks)
+    int  m_noiseCellSizeZ    = 8; // Cell height along Z (blocks)
+    bool m_compareNoiseCells = false; // Also evaluate exact density and log mismatch / timing statistics
+
+    // Batch noise: sample climate and density noise through the game's SIMD BatchPerlinNoise
+    // instead of the engine's per-point PerlinNoiseGenerator (produces a different world)
+    bool        m_useBatchNoise  = false; // Enable batch (row/column) noise sampling
+    std::string m_batchNoiseSimd = "auto"; // auto, avx2, sse4.1, scalar
+    bool        m_batchNoiseFixed = true; // Density noise through the compile-time kernel (false: runtime params, for tuning)
+
+    // Noise backend: "classic" keeps the engine / batch Perlin above; "perlin", "opensimplex2" and
+    // "valuegradient" sample every channel from one shared permutation table (produces a different world)
+    std::string m_noiseBackend   = "classic";
+    bool        m_noiseBenchmark = false; // Log ns/sample and density differences of every backend at startup
+
+    // Height band culling: only evaluate 3D density noise where the column terms alone
+    // cannot decide solid/air for any noise value within [-bound, bound]
+    bool  m_useHeightBandCulling = true; // Skip 3D noise in certainly-solid / certainly-air Z ranges
+    float m_densityNoiseBound    = 1.0f; // Maximum |density noise| (renormalized octave sum)
+
+    // Climate tile cache: 16x16 column tiles of the five climate noises shared by all
+    // ChunkGen threads, so chunk borders / tree placement rings are sampled once per world
+    bool m_useClimateCache      = true; // Enable the shared climate tile cache
+    int  m_climateCacheMaxTiles = 1024; // LRU capacity in tiles (~5 KB each)
+
+    // Heightmap service: surface heights of generated chunks (exact) and of ungenerated
+    // tiles (analytic estimate), used instead of binary-searching the density field
+    int m_heightmapGeneratedTiles = 4096; // Exact heightmaps kept (512 bytes each)
+    int m_heightmapEstimatedTiles = 1024; // Estimated heightmaps kept (512 bytes each)
+
+    // Spline lookup tables: bake the height offset / squashing / erosion splines into
+    // linear-interpolated tables at construction (exact spline if a table misses the tolerance)
+    bool  m_useSplineLut        = false; // Evaluate splines through baked tables (different terrain within tolerance)
+    int   m_splineLutResolution = 2048; // Table entries over the [-1, 1] input range
+    float m_splineLutTolerance  = 1.0e-4f; // Max |table - spline| accepted per table
+
+    // Tree placement: "noise" scans every column for tree noise local maxima, "grid" takes one
+    // hashed, jittered site per grid cell accepted with the biome's tree density (different trees)
+    std::string m_treePlacement        = "noise"; // noise, grid
+    int         m_treeGridCellSize     = 6; // Grid cell width (blocks), at most one tree per cell
+    bool        m_compareTreePlacement = false; // Also enumerate the other mode's sites and log count / timing statistics
+
+    // Generation pipeline: chunks pass through climate, shape, surface and feature stages before
+    // being committed; each stage is timed separately
+    bool m_logStageTimings = false; // Log average per-stage cost every 64 chunks
+
+    // Point features placed in the features stage from counter-based random streams (no noise)
+    bool m_useOreVeins = true; // Coal, iron, gold and diamond veins in stone
+    bool m_useCaves    = true; // Cheese / spaghetti caves and lava lakes below the surface
+};
+
+//-----------------------------------------------------------------------------------------------
+// WorldGenConfigParser - Utility class for loading world generation configuration from YAML
+// Provides validation to ensure all parameters are within reasonable ranges
+//-----------------------------------------------------------------------------------------------
+class WorldGenConfigParser
+{
+public:
+    /// Loads world generation configuration from YAML file
+    /// @param yamlPath Path to YAML configuration file (e.g., "Run/.enigma/settings.yml")
+    /// @return WorldGenConfig with loaded values, or defaults if loading fails
+    static WorldGenConfig LoadFromYaml(const std::string& yamlPath);
+
+    /// Validates world generation configuration parameters
+    /// @param config Configuration to validate
+    /// @return true if all parameters are within valid ranges, false otherwise
+    static bool ValidateConfig(const WorldGenConfig& config);
+};
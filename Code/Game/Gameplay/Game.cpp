@@ -3,6 +3,8 @@
 #include "../Framework/App.hpp"
 #include "../GameCommon.hpp"
 #include "Generator/SimpleMinerGenerator.hpp"
+#include "Generator/WorldGenBenchmark.hpp"
+#include "Generator/WorldPregenerator.hpp"
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Core/EngineCommon.hpp"
 #include "Engine/Core/FileUtils.hpp"
@@ -35,6 +37,7 @@
 #include "Engine/Window/Window.hpp"
 #include "Game/Framework/DummyTask.hpp"
 #include "Game/Framework/GUISubsystem.hpp"
+#include "Game/Framework/WorldGenConfigParser.hpp"
 #include "gui/GUIDebugLight.hpp"
 #include "gui/GUIProfiler.hpp"
 #include "gui/GUIPlayerStats.hpp"
@@ -42,8 +45,15 @@
 #include "Player/GameCamera.hpp"
 #include "Player/Player.hpp"
 
+namespace
+{
+    // Seeds of the "world" save; pregeneration writes into the same save, so it must use them too
+    constexpr uint32_t WORLD_GENERATOR_SEED = 0;
+    constexpr uint64_t WORLD_SEED           = 6693073380;
+}
+
 
-Game::Game()
+Game::Game(const PregenerationRequest* pregeneration, const WorldGenBenchmarkRequest* benchmark)
 {
     /// Rasterize
     g_theRenderer->SetRasterizerMode(RasterizerMode::SOLID_CULL_BACK);
@@ -90,11 +100,28 @@ Game::Game()
     /// World Creation with RAII constructor
     using namespace enigma::voxel;
 
-    auto generator     = std::make_unique<SimpleMinerGenerator>();
-    m_world            = std::make_unique<World>("world", 6693073380, std::move(generator));
-    int renderDistance = settings.GetInt("video.simulationDistance", 24);
-    m_world->SetChunkActivationRange(renderDistance);
-    LogInfo(LogGame, "Render distance configured: %d chunks (using independent generators per chunk)", renderDistance);
+    WorldGenConfig worldGenConfig = WorldGenConfigParser::LoadFromYaml(".enigma/settings.yml");
+    if (benchmark)
+    {
+        // Benchmark run: standalone generators on their own threads, no world is created or saved
+        bool passed = WorldGenBenchmark::Run(*benchmark, worldGenConfig);
+        LogInfo(LogGame, "World generation benchmark %s", passed ? "finished" : "failed");
+        g_theApp->HandleQuitRequested(!passed);
+    }
+    else
+    {
+        auto generator     = std::make_unique<SimpleMinerGenerator>(WORLD_GENERATOR_SEED, worldGenConfig);
+        m_worldGenerator   = generator.get();
+        m_world            = std::make_unique<World>("world", WORLD_SEED, std::move(generator));
+        int renderDistance = settings.GetInt("video.simulationDistance", 24);
+        m_world->SetChunkActivationRange(renderDistance);
+        LogInfo(LogGame, "Render distance configured: %d chunks (using independent generators per chunk)", renderDistance);
+
+        if (pregeneration)
+        {
+            m_pregenerator = std::make_unique<WorldPregenerator>(*pregeneration, renderDistance);
+        }
+    }
 
     /// Resource preload
     m_worldShader = g_theRenderer->CreateOrGetShader(".enigma/data/Shaders/World");
@@ -111,12 +138,17 @@ Game::~Game()
 
         // ===== Phase 5: Graceful Shutdown =====
         LogInfo(LogGame, "Initiating graceful shutdown...");
+        if (m_worldGenerator)
+        {
+            m_worldGenerator->CancelPendingGeneration(); // In-flight chunks stop at their next stage
+        }
         m_world->PrepareShutdown(); // Stop new tasks
         m_world->WaitForPendingTasks(); // Wait for completion
 
         LogInfo(LogGame, "Closing world...");
         m_world->CloseWorld();
         m_world.reset();
+        m_worldGenerator = nullptr;
     }
 
     POINTER_SAFE_DELETE(m_worldCBO)
@@ -171,6 +203,19 @@ void Game::UpdateCameras(float deltaTime)
 
 void Game::Update()
 {
+    // Pregeneration run: the activation centre follows the pregenerator, no player or menu
+    if (m_pregenerator)
+    {
+        m_player->m_position = m_pregenerator->GetFocusPosition();
+        UpdateWorld();
+        if (m_pregenerator->Update(*m_world))
+        {
+            // Update also ends the run when chunks cannot be saved; that is a failure, not completion
+            g_theApp->HandleQuitRequested(!m_pregenerator->IsFinished());
+        }
+        return;
+    }
+
     if (m_isInMainMenu)
     {
         g_theInput->SetCursorMode(CursorMode::POINTER);
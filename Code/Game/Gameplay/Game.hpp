@@ -14,11 +14,15 @@ namespace enigma::voxel
 
 class Player;
 class Clock;
+class SimpleMinerGenerator;
+class WorldPregenerator;
+struct PregenerationRequest;
+struct WorldGenBenchmarkRequest;
 
 class Game
 {
 public:
-    Game();
+    explicit Game(const PregenerationRequest* pregeneration = nullptr, const WorldGenBenchmarkRequest* benchmark = nullptr);
     ~Game();
     void Render() const;
     void Update();
@@ -46,6 +50,8 @@ public:
 
 public:
     std::unique_ptr<enigma::voxel::World> m_world;
+    SimpleMinerGenerator*                 m_worldGenerator   = nullptr; // Owned by m_world
+    std::unique_ptr<WorldPregenerator>    m_pregenerator; // Only for a -pregen run
     bool                                  m_enableChunkDebug = true;
 
     Shader*         m_worldShader = nullptr;
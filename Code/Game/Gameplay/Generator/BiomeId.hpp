@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Dense identity of SimpleMiner's biomes, index into the generator's per-biome tables
+ *
+ * Order matches SimpleMinerGenerator::InitializeBiomes(). Count doubles as "no biome".
+ */
+enum class BiomeId : uint8_t
+{
+    Ocean = 0,
+    DeepOcean,
+    FrozenOcean,
+    Beach,
+    SnowyBeach,
+    Desert,
+    Savanna,
+    Plains,
+    SnowyPlains,
+    Forest,
+    Jungle,
+    Taiga,
+    SnowyTaiga,
+    StonyPeaks,
+    SnowyPeaks,
+    Count
+};
+
+constexpr size_t BIOME_COUNT = static_cast<size_t>(BiomeId::Count);
+
+constexpr size_t ToIndex(BiomeId id)
+{
+    return static_cast<size_t>(id);
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include "BiomeId.hpp"
+#include <vector>
+
+/**
+ * @brief Biome of every column in a rectangular world area, computed once per chunk
+ *
+ * SimpleMinerGenerator fills it for the chunk's 16x16 columns plus the tree placement
+ * border; surface rules and SimpleMinerTreeGenerator read from it instead of calling
+ * GetBiomeAt() (five 2D noises + classification) again for the same column.
+ *
+ * Stores BiomeId (SimpleMinerGenerator::GetBiome() for the instance). Bounds are inclusive.
+ */
+class BiomeMap
+{
+public:
+    void Reset(int minX, int minY, int maxX, int maxY)
+    {
+        m_minX   = minX;
+        m_minY   = minY;
+        m_width  = maxX - minX + 1;
+        m_height = maxY - minY + 1;
+        m_biomes.assign(static_cast<size_t>(m_width) * m_height, BiomeId::Count);
+    }
+
+    bool Contains(int globalX, int globalY) const
+    {
+        return globalX >= m_minX && globalX < m_minX + m_width &&
+            globalY >= m_minY && globalY < m_minY + m_height;
+    }
+
+    BiomeId Get(int globalX, int globalY) const
+    {
+        return m_biomes[Index(globalX, globalY)];
+    }
+
+    void Set(int globalX, int globalY, BiomeId biome)
+    {
+        m_biomes[Index(globalX, globalY)] = biome;
+    }
+
+    int GetMinX() const { return m_minX; }
+    int GetMinY() const { return m_minY; }
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+
+private:
+    size_t Index(int globalX, int globalY) const
+    {
+        return static_cast<size_t>(globalY - m_minY) * m_width + (globalX - m_minX);
+    }
+
+    int                  m_minX   = 0;
+    int                  m_minY   = 0;
+    int                  m_width  = 0;
+    int                  m_height = 0;
+    std::vector<BiomeId> m_biomes;
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Floor division for possibly negative world coordinates (-1 / 4 == -1, not 0)
+inline int FloorDivide(int value, int divisor)
+{
+    int quotient = value / divisor;
+    if ((value % divisor != 0) && ((value < 0) != (divisor < 0)))
+    {
+        --quotient;
+    }
+    return quotient;
+}
+
+/**
+ * @brief Hash of chunk / tile coordinates for unordered containers (salt: e.g. the seed of a seeded key)
+ */
+inline size_t HashChunkKey(int32_t chunkX, int32_t chunkY, uint32_t salt = 0)
+{
+    uint64_t hash = static_cast<uint32_t>(chunkX);
+    hash          = hash * 0x100000001B3ull ^ static_cast<uint32_t>(chunkY);
+    hash          = hash * 0x100000001B3ull ^ salt;
+    return static_cast<size_t>(hash ^ (hash >> 29));
+}
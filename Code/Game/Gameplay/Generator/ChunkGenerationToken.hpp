@@ -0,0 +1,45 @@
+#pragma once
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include <atomic>
+#include <cstdint>
+
+using namespace enigma::voxel;
+
+/**
+ * @brief Cooperative cancellation token for one GenerateChunk call
+ *
+ * A chunk generation is abandoned when either
+ *  - the world moves the chunk out of ChunkState::Generating (unloaded / deactivated), or
+ *  - the generator's cancel epoch changes (SimpleMinerGenerator::CancelPendingGeneration(),
+ *    used on shutdown so in-flight chunks stop at their next stage boundary).
+ *
+ * The generator polls the token only at stage and section boundaries, never per voxel.
+ * Once cancelled the token stays cancelled, so later polls are a single branch.
+ * A token without a chunk (detached proto chunks) is only cancelled through the epoch.
+ */
+class ChunkGenerationToken
+{
+public:
+    ChunkGenerationToken(Chunk* chunk, const std::atomic<uint32_t>& cancelEpoch)
+        : m_chunk(chunk)
+          , m_cancelEpoch(cancelEpoch)
+          , m_startEpoch(cancelEpoch.load(std::memory_order_relaxed))
+    {
+    }
+
+    bool IsCancelled()
+    {
+        if (!m_cancelled)
+        {
+            m_cancelled = m_cancelEpoch.load(std::memory_order_relaxed) != m_startEpoch ||
+                (m_chunk && m_chunk->GetState() != ChunkState::Generating);
+        }
+        return m_cancelled;
+    }
+
+private:
+    Chunk*                       m_chunk;
+    const std::atomic<uint32_t>& m_cancelEpoch;
+    uint32_t                     m_startEpoch;
+    bool                         m_cancelled = false;
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include "ChunkCoords.hpp"
+#include "ShardedLruCache.hpp"
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief The five 2D climate noises of one chunk-aligned 16x16 column tile
+ *
+ * Tile (tileX, tileY) covers world columns [tileX * 16, tileX * 16 + 15] x [tileY * 16, tileY * 16 + 15],
+ * i.e. exactly the columns of chunk (tileX, tileY). Arrays are indexed [y][x] in local tile coordinates.
+ */
+struct ClimateTile
+{
+    static constexpr int SIZE         = 16;
+    static constexpr int COLUMN_COUNT = SIZE * SIZE;
+
+    float temperature[COLUMN_COUNT];
+    float humidity[COLUMN_COUNT];
+    float continentalness[COLUMN_COUNT];
+    float erosion[COLUMN_COUNT];
+    float peaksValleys[COLUMN_COUNT]; // Folded PV, as returned by SampleNoise2D(PeaksValleys)
+};
+
+struct ClimateTileKey
+{
+    int32_t  tileX = 0;
+    int32_t  tileY = 0;
+    uint32_t seed  = 0;
+
+    bool operator==(const ClimateTileKey& other) const
+    {
+        return tileX == other.tileX && tileY == other.tileY && seed == other.seed;
+    }
+};
+
+struct ClimateTileKeyHash
+{
+    size_t operator()(const ClimateTileKey& key) const
+    {
+        return HashChunkKey(key.tileX, key.tileY, key.seed);
+    }
+};
+
+/**
+ * @brief World-wide climate tile cache shared by all ChunkGen threads
+ *
+ * Border columns needed by several chunks (biome map / tree placement ring) are computed once.
+ */
+using ClimateTileCache = ShardedLruCache<ClimateTileKey, ClimateTile, ClimateTileKeyHash>;
@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Outcome of parsing a run mode (-pregen, -worldgenbench, -worldgenverify) from the command line
+ */
+enum class CommandLineRequest : uint8_t
+{
+    NotRequested, // Flag absent: start the game normally
+    Valid,        // Request parsed into the output struct
+    Invalid       // Flag present but malformed or not runnable (logged): the app quits with a failure
+};
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Counter-based random stream for feature placement (SplitMix64 finalizer)
+ *
+ * Every value is a pure hash of (seed, chunk, stream, counter): the same feature of the same chunk
+ * draws the same numbers no matter which thread generates it or in which order chunks are generated.
+ * Streams separate independent features of a chunk (e.g. one per ore vein).
+ */
+class FeatureRandom
+{
+public:
+    FeatureRandom(uint32_t seed, int32_t chunkX, int32_t chunkY, uint32_t stream)
+    {
+        uint64_t chunkKey = (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkY);
+        m_key             = Mix(static_cast<uint64_t>(seed) ^ Mix(chunkKey ^ Mix(stream)));
+    }
+
+    uint32_t NextUInt()
+    {
+        return static_cast<uint32_t>(Mix(m_key + GOLDEN_GAMMA * ++m_counter) >> 32);
+    }
+
+    // Uniform in [minValue, maxValue]
+    int RangeInt(int minValue, int maxValue)
+    {
+        uint32_t span = static_cast<uint32_t>(maxValue - minValue) + 1u;
+        return minValue + static_cast<int>((static_cast<uint64_t>(NextUInt()) * span) >> 32);
+    }
+
+    // [0, 1) from the top 24 bits
+    float ZeroToOne()
+    {
+        return static_cast<float>(NextUInt() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    static uint64_t Mix(uint64_t value)
+    {
+        value += GOLDEN_GAMMA;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+private:
+    static constexpr uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+
+    uint64_t m_key     = 0;
+    uint64_t m_counter = 0;
+};
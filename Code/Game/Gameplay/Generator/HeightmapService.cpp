@@ -0,0 +1,76 @@
+#include "HeightmapService.hpp"
+#include <memory>
+#include <utility>
+
+HeightmapService::HeightmapService(size_t        maxGeneratedTiles, size_t maxEstimatedTiles,
+                                   TileEstimator estimator, ColumnSolver      exactSolver)
+    : m_generated(maxGeneratedTiles)
+      , m_estimated(maxEstimatedTiles)
+      , m_estimator(std::move(estimator))
+      , m_exactSolver(std::move(exactSolver))
+{
+}
+
+void HeightmapService::StoreGenerated(int32_t chunkX, int32_t chunkY, const int* surfaceHeight)
+{
+    auto tile = std::make_shared<SurfaceHeightTile>();
+    for (int column = 0; column < SurfaceHeightTile::COLUMN_COUNT; ++column)
+    {
+        tile->heights[column] = static_cast<int16_t>(surfaceHeight[column]);
+    }
+    m_generated.Insert(SurfaceHeightTileKey{chunkX, chunkY}, std::move(tile));
+}
+
+bool HeightmapService::TryGetGenerated(int globalX, int globalY, int& outHeight) const
+{
+    int                                      column = 0;
+    std::shared_ptr<const SurfaceHeightTile> tile   = m_generated.Find(GetTileKey(globalX, globalY, column));
+    if (!tile)
+    {
+        return false;
+    }
+    outHeight = tile->heights[column];
+    return true;
+}
+
+int HeightmapService::GetExactHeight(int globalX, int globalY) const
+{
+    int height = -1;
+    if (TryGetGenerated(globalX, globalY, height))
+    {
+        return height;
+    }
+    return m_exactSolver(globalX, globalY);
+}
+
+int HeightmapService::GetEstimatedHeight(int globalX, int globalY) const
+{
+    int                  column = 0;
+    SurfaceHeightTileKey key    = GetTileKey(globalX, globalY, column);
+    auto                 tile   = m_estimated.GetOrCreate(key, [&]()
+    {
+        auto estimate = std::make_shared<SurfaceHeightTile>();
+        m_estimator(key.tileX, key.tileY, estimate->heights);
+        return estimate;
+    });
+    return tile->heights[column];
+}
+
+int HeightmapService::GetSurfaceHeight(int globalX, int globalY) const
+{
+    int height = -1;
+    if (TryGetGenerated(globalX, globalY, height))
+    {
+        return height;
+    }
+    return GetEstimatedHeight(globalX, globalY);
+}
+
+SurfaceHeightTileKey HeightmapService::GetTileKey(int globalX, int globalY, int& outColumn)
+{
+    // Floor division so negative coordinates map to the tile that contains them
+    int tileX = FloorDivide(globalX, SurfaceHeightTile::SIZE);
+    int tileY = FloorDivide(globalY, SurfaceHeightTile::SIZE);
+    outColumn = (globalY - tileY * SurfaceHeightTile::SIZE) * SurfaceHeightTile::SIZE + (globalX - tileX * SurfaceHeightTile::SIZE);
+    return SurfaceHeightTileKey{tileX, tileY};
+}
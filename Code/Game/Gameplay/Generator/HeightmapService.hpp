@@ -0,0 +1,105 @@
+#pragma once
+#include "ChunkCoords.hpp"
+#include "ShardedLruCache.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+/**
+ * @brief Surface heights of one chunk-aligned 16x16 column tile, indexed [y][x]
+ *
+ * A height is the topmost solid Z of the column, -1 if the column has no solid block.
+ */
+struct SurfaceHeightTile
+{
+    static constexpr int SIZE         = 16;
+    static constexpr int COLUMN_COUNT = SIZE * SIZE;
+
+    int16_t heights[COLUMN_COUNT];
+};
+
+struct SurfaceHeightTileKey
+{
+    int32_t tileX = 0;
+    int32_t tileY = 0;
+
+    bool operator==(const SurfaceHeightTileKey& other) const
+    {
+        return tileX == other.tileX && tileY == other.tileY;
+    }
+};
+
+struct SurfaceHeightTileKeyHash
+{
+    size_t operator()(const SurfaceHeightTileKey& key) const
+    {
+        return HashChunkKey(key.tileX, key.tileY);
+    }
+};
+
+/**
+ * @brief Surface height queries without re-evaluating the density field
+ *
+ * Two thread-safe LRU caches of SurfaceHeightTile:
+ *  - generated: exact heights published by GenerateChunk (the terrain pass heightmap)
+ *  - estimated: analytic heights of ungenerated tiles from the column terms alone
+ *    (3D noise treated as 0), computed once per tile by the estimator callback
+ *
+ * GetSurfaceHeight() is exact for generated columns and an estimate otherwise, which is
+ * fine for spawn finding and ground queries. Callers that must agree across chunks no matter
+ * which chunk generated first (tree placement across chunk borders) use GetExactHeight(),
+ * which falls back to the exact column solver instead of the estimate.
+ *
+ * Heights are generation-time values; later block edits are not reflected.
+ */
+class HeightmapService
+{
+public:
+    /// Fills the estimated heights of tile (tileX, tileY) into outHeights[COLUMN_COUNT]
+    using TileEstimator = std::function<void(int32_t tileX, int32_t tileY, int16_t* outHeights)>;
+
+    /// Exact topmost solid Z of one column (evaluates the density field)
+    using ColumnSolver = std::function<int(int globalX, int globalY)>;
+
+    /**
+     * @param maxGeneratedTiles Capacity of the exact (generated chunk) cache
+     * @param maxEstimatedTiles Capacity of the estimate cache
+     */
+    HeightmapService(size_t        maxGeneratedTiles, size_t maxEstimatedTiles,
+                     TileEstimator estimator, ColumnSolver      exactSolver);
+
+    /**
+     * @brief Publish the exact heights of a generated chunk ([y][x], -1 = no solid)
+     */
+    void StoreGenerated(int32_t chunkX, int32_t chunkY, const int* surfaceHeight);
+
+    /**
+     * @brief Exact height if the column's chunk has been generated
+     */
+    bool TryGetGenerated(int globalX, int globalY, int& outHeight) const;
+
+    /**
+     * @brief Exact height: generated heightmap, else the exact column solver
+     */
+    int GetExactHeight(int globalX, int globalY) const;
+
+    /**
+     * @brief Cached analytic estimate (never evaluates 3D noise)
+     */
+    int GetEstimatedHeight(int globalX, int globalY) const;
+
+    /**
+     * @brief Exact height for generated columns, estimate otherwise
+     */
+    int GetSurfaceHeight(int globalX, int globalY) const;
+
+private:
+    using TileCache = ShardedLruCache<SurfaceHeightTileKey, SurfaceHeightTile, SurfaceHeightTileKeyHash>;
+
+    static SurfaceHeightTileKey GetTileKey(int globalX, int globalY, int& outColumn);
+
+    mutable TileCache m_generated;
+    mutable TileCache m_estimated;
+    TileEstimator     m_estimator;
+    ColumnSolver      m_exactSolver;
+};
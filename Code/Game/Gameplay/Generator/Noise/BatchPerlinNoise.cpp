@@ -0,0 +1,388 @@
+#include "BatchPerlinNoise.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if BATCH_NOISE_HAS_X86_SIMD && defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+#include "BatchPerlinNoiseKernels.hpp"
+
+namespace BatchNoiseKernels
+{
+    // Single-lane instantiation: the reference path and the tail of every SIMD batch
+    struct ScalarLanes
+    {
+        static constexpr int WIDTH = 1;
+        using Float                = float;
+        using Int                  = uint32_t;
+
+        static Float Load(const float* p) { return *p; }
+        static void  Store(float* p, Float v) { *p = v; }
+        static Float Set(float v) { return v; }
+        static Int   SetInt(uint32_t v) { return v; }
+
+        static Float Add(Float a, Float b) { return a + b; }
+        static Float Sub(Float a, Float b) { return a - b; }
+        static Float Mul(Float a, Float b) { return a * b; }
+        static Float Div(Float a, Float b) { return a / b; }
+        static Float Min(Float a, Float b) { return (a < b) ? a : b; } // Same operand order as minps
+        static Float Max(Float a, Float b) { return (a > b) ? a : b; } // Same operand order as maxps
+        static Float Floor(Float v) { return std::floor(v); }
+        static Int   FloatToInt(Float v) { return static_cast<uint32_t>(static_cast<int32_t>(v)); }
+
+        static Int IntAdd(Int a, Int b) { return a + b; }
+        static Int IntMul(Int a, Int b) { return a * b; }
+        static Int IntXor(Int a, Int b) { return a ^ b; }
+
+        template <int N>
+        static Int ShiftRight(Int v) { return v >> N; }
+
+        static Float SelectByBit(Int hash, uint32_t mask, Float ifSet, Float ifClear)
+        {
+            return ((hash & mask) == mask) ? ifSet : ifClear;
+        }
+
+        template <int BIT>
+        static Float NegateIfBit(Float v, Int hash)
+        {
+            return ((hash >> BIT) & 1u) ? -v : v;
+        }
+    };
+}
+
+using namespace BatchNoiseKernels;
+
+BatchPerlinNoise::BatchPerlinNoise(uint32_t seed, float scale, unsigned int octaves, float persistence, float octaveScale, bool renormalize)
+{
+    m_params.seed        = seed;
+    m_params.invScale    = 1.0f / scale;
+    m_params.octaves     = (std::min)(octaves, MAX_OCTAVES);
+    m_params.octaveScale = octaveScale;
+    m_params.renormalize = renormalize;
+
+    float amplitude          = 1.0f;
+    m_params.totalAmplitude  = 0.0f;
+    for (unsigned int octave = 0; octave < m_params.octaves; ++octave)
+    {
+        m_params.amplitudes[octave] = amplitude;
+        m_params.totalAmplitude += amplitude;
+        amplitude *= persistence;
+    }
+
+    m_simdLevel = DetectSimdLevel();
+}
+
+float BatchPerlinNoise::Sample2D(float x, float y) const
+{
+    return Fractal2D<ScalarLanes>(m_params, x, y);
+}
+
+float BatchPerlinNoise::Sample3D(float x, float y, float z) const
+{
+    return Fractal3D<ScalarLanes>(m_params, x, y, z);
+}
+
+void BatchPerlinNoise::Sample2DBatch(const float* xs, const float* ys, float* out, int count) const
+{
+    int done = 0;
+#if BATCH_NOISE_HAS_X86_SIMD
+    switch (m_simdLevel)
+    {
+    case NoiseSimdLevel::AVX2:
+        done = SampleBatch2D_AVX2(m_params, xs, ys, out, count);
+        break;
+    case NoiseSimdLevel::SSE41:
+        done = SampleBatch2D_SSE41(m_params, xs, ys, out, count);
+        break;
+    default:
+        break;
+    }
+#endif
+    // Remaining points (or everything in scalar mode)
+    SampleBatch2D<ScalarLanes>(m_params, xs + done, ys + done, out + done, count - done);
+}
+
+void BatchPerlinNoise::Sample3DBatch(const float* xs, const float* ys, const float* zs, float* out, int count) const
+{
+    int done = 0;
+#if BATCH_NOISE_HAS_X86_SIMD
+    switch (m_simdLevel)
+    {
+    case NoiseSimdLevel::AVX2:
+        done = SampleBatch3D_AVX2(m_params, xs, ys, zs, out, count);
+        break;
+    case NoiseSimdLevel::SSE41:
+        done = SampleBatch3D_SSE41(m_params, xs, ys, zs, out, count);
+        break;
+    default:
+        break;
+    }
+#endif
+    // Remaining points (or everything in scalar mode)
+    SampleBatch3D<ScalarLanes>(m_params, xs + done, ys + done, zs + done, out + done, count - done);
+}
+
+namespace
+{
+    // Rows and columns are expanded into point lists in small stack blocks
+    constexpr int BATCH_BLOCK_SIZE = 64;
+
+    // Fixed point set covering negative coordinates, lattice boundaries and fractional positions
+    constexpr int VERIFY_COUNT = 67; // Deliberately not a multiple of 8 to exercise the tail
+
+    void MakeVerifyPoints(float* xs, float* ys, float* zs)
+    {
+        for (int i = 0; i < VERIFY_COUNT; ++i)
+        {
+            xs[i] = static_cast<float>(i * 37 - 1200) + 0.25f * static_cast<float>(i % 4);
+            ys[i] = static_cast<float>(800 - i * 53);
+            zs[i] = static_cast<float>(i * 4);
+        }
+    }
+
+    template <typename Noise>
+    void Sample3DRowBlocks(const Noise& noise, float startX, float stepX, float y, float z, float* out, int count)
+    {
+        float xs[BATCH_BLOCK_SIZE];
+        float ys[BATCH_BLOCK_SIZE];
+        float zs[BATCH_BLOCK_SIZE];
+        for (int blockStart = 0; blockStart < count; blockStart += BATCH_BLOCK_SIZE)
+        {
+            int blockCount = (std::min)(BATCH_BLOCK_SIZE, count - blockStart);
+            for (int i = 0; i < blockCount; ++i)
+            {
+                xs[i] = startX + static_cast<float>(blockStart + i) * stepX;
+                ys[i] = y;
+                zs[i] = z;
+            }
+            noise.Sample3DBatch(xs, ys, zs, out + blockStart, blockCount);
+        }
+    }
+
+    template <typename Noise>
+    void Sample3DColumnBlocks(const Noise& noise, float x, float y, float startZ, float stepZ, float* out, int count)
+    {
+        float xs[BATCH_BLOCK_SIZE];
+        float ys[BATCH_BLOCK_SIZE];
+        float zs[BATCH_BLOCK_SIZE];
+        for (int blockStart = 0; blockStart < count; blockStart += BATCH_BLOCK_SIZE)
+        {
+            int blockCount = (std::min)(BATCH_BLOCK_SIZE, count - blockStart);
+            for (int i = 0; i < blockCount; ++i)
+            {
+                xs[i] = x;
+                ys[i] = y;
+                zs[i] = startZ + static_cast<float>(blockStart + i) * stepZ;
+            }
+            noise.Sample3DBatch(xs, ys, zs, out + blockStart, blockCount);
+        }
+    }
+}
+
+void BatchPerlinNoise::Sample2DRow(float startX, float stepX, float y, float* out, int count) const
+{
+    float xs[BATCH_BLOCK_SIZE];
+    float ys[BATCH_BLOCK_SIZE];
+    for (int blockStart = 0; blockStart < count; blockStart += BATCH_BLOCK_SIZE)
+    {
+        int blockCount = (std::min)(BATCH_BLOCK_SIZE, count - blockStart);
+        for (int i = 0; i < blockCount; ++i)
+        {
+            xs[i] = startX + static_cast<float>(blockStart + i) * stepX;
+            ys[i] = y;
+        }
+        Sample2DBatch(xs, ys, out + blockStart, blockCount);
+    }
+}
+
+void BatchPerlinNoise::Sample3DRow(float startX, float stepX, float y, float z, float* out, int count) const
+{
+    Sample3DRowBlocks(*this, startX, stepX, y, z, out, count);
+}
+
+void BatchPerlinNoise::Sample3DColumn(float x, float y, float startZ, float stepZ, float* out, int count) const
+{
+    Sample3DColumnBlocks(*this, x, y, startZ, stepZ, out, count);
+}
+
+void BatchPerlinNoise::SetSimdLevel(NoiseSimdLevel level)
+{
+    NoiseSimdLevel supported = DetectSimdLevel();
+    m_simdLevel              = (static_cast<uint8_t>(level) <= static_cast<uint8_t>(supported)) ? level : supported;
+}
+
+NoiseSimdLevel BatchPerlinNoise::DetectSimdLevel()
+{
+    static const NoiseSimdLevel s_detectedLevel = []()
+    {
+#if BATCH_NOISE_HAS_X86_SIMD && defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 0);
+        int maxLeaf = info[0];
+
+        __cpuidex(info, 1, 0);
+        bool hasSse41   = (info[2] & (1 << 19)) != 0;
+        bool hasOsxsave = (info[2] & (1 << 27)) != 0;
+        bool hasAvx     = (info[2] & (1 << 28)) != 0;
+
+        bool hasAvx2 = false;
+        if (maxLeaf >= 7 && hasAvx && hasOsxsave)
+        {
+            // The OS must save YMM state on context switches
+            bool osSavesYmm = (_xgetbv(0) & 0x6) == 0x6;
+            __cpuidex(info, 7, 0);
+            hasAvx2 = osSavesYmm && (info[1] & (1 << 5)) != 0;
+        }
+
+        if (hasAvx2)
+        {
+            return NoiseSimdLevel::AVX2;
+        }
+        return hasSse41 ? NoiseSimdLevel::SSE41 : NoiseSimdLevel::Scalar;
+#elif BATCH_NOISE_HAS_X86_SIMD && defined(__GNUC__)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return NoiseSimdLevel::AVX2;
+        }
+        return __builtin_cpu_supports("sse4.1") ? NoiseSimdLevel::SSE41 : NoiseSimdLevel::Scalar;
+#else
+        return NoiseSimdLevel::Scalar;
+#endif
+    }();
+    return s_detectedLevel;
+}
+
+const char* BatchPerlinNoise::GetSimdLevelName(NoiseSimdLevel level)
+{
+    switch (level)
+    {
+    case NoiseSimdLevel::AVX2:
+        return "AVX2";
+    case NoiseSimdLevel::SSE41:
+        return "SSE4.1";
+    default:
+        return "Scalar";
+    }
+}
+
+bool BatchPerlinNoise::VerifySimdLevel(NoiseSimdLevel level) const
+{
+    if (level == NoiseSimdLevel::Scalar)
+    {
+        return true;
+    }
+
+    float xs[VERIFY_COUNT];
+    float ys[VERIFY_COUNT];
+    float zs[VERIFY_COUNT];
+    MakeVerifyPoints(xs, ys, zs);
+
+    BatchPerlinNoise simdNoise = *this;
+    simdNoise.SetSimdLevel(level);
+    if (simdNoise.GetSimdLevel() != level)
+    {
+        return false;
+    }
+
+    float simd2D[VERIFY_COUNT];
+    float simd3D[VERIFY_COUNT];
+    simdNoise.Sample2DBatch(xs, ys, simd2D, VERIFY_COUNT);
+    simdNoise.Sample3DBatch(xs, ys, zs, simd3D, VERIFY_COUNT);
+
+    for (int i = 0; i < VERIFY_COUNT; ++i)
+    {
+        float scalar2D = Sample2D(xs[i], ys[i]);
+        float scalar3D = Sample3D(xs[i], ys[i], zs[i]);
+        if (std::memcmp(&scalar2D, &simd2D[i], sizeof(float)) != 0 || std::memcmp(&scalar3D, &simd3D[i], sizeof(float)) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ========== FixedBatchPerlinNoise ==========
+
+template <typename Traits>
+FixedBatchPerlinNoise<Traits>::FixedBatchPerlinNoise(uint32_t seed)
+    : m_seed(seed)
+      , m_simdLevel(BatchPerlinNoise::DetectSimdLevel())
+{
+}
+
+template <typename Traits>
+float FixedBatchPerlinNoise<Traits>::Sample3D(float x, float y, float z) const
+{
+    return FractalSum3D<ScalarLanes>(FixedFractal<ScalarLanes, Traits>{m_seed}, x, y, z);
+}
+
+template <typename Traits>
+void FixedBatchPerlinNoise<Traits>::Sample3DBatch(const float* xs, const float* ys, const float* zs, float* out, int count) const
+{
+    int done = 0;
+#if BATCH_NOISE_HAS_X86_SIMD
+    switch (m_simdLevel)
+    {
+    case NoiseSimdLevel::AVX2:
+        done = SampleFixedBatch3D_AVX2<Traits>(m_seed, xs, ys, zs, out, count);
+        break;
+    case NoiseSimdLevel::SSE41:
+        done = SampleFixedBatch3D_SSE41<Traits>(m_seed, xs, ys, zs, out, count);
+        break;
+    default:
+        break;
+    }
+#endif
+    // Remaining points (or everything in scalar mode)
+    SampleFixedBatch3D<ScalarLanes, Traits>(m_seed, xs + done, ys + done, zs + done, out + done, count - done);
+}
+
+template <typename Traits>
+void FixedBatchPerlinNoise<Traits>::Sample3DRow(float startX, float stepX, float y, float z, float* out, int count) const
+{
+    Sample3DRowBlocks(*this, startX, stepX, y, z, out, count);
+}
+
+template <typename Traits>
+void FixedBatchPerlinNoise<Traits>::Sample3DColumn(float x, float y, float startZ, float stepZ, float* out, int count) const
+{
+    Sample3DColumnBlocks(*this, x, y, startZ, stepZ, out, count);
+}
+
+template <typename Traits>
+void FixedBatchPerlinNoise<Traits>::SetSimdLevel(NoiseSimdLevel level)
+{
+    NoiseSimdLevel supported = BatchPerlinNoise::DetectSimdLevel();
+    m_simdLevel              = (static_cast<uint8_t>(level) <= static_cast<uint8_t>(supported)) ? level : supported;
+}
+
+template <typename Traits>
+bool FixedBatchPerlinNoise<Traits>::VerifyAgainst(const BatchPerlinNoise& reference) const
+{
+    float xs[VERIFY_COUNT];
+    float ys[VERIFY_COUNT];
+    float zs[VERIFY_COUNT];
+    MakeVerifyPoints(xs, ys, zs);
+
+    float fixed[VERIFY_COUNT];
+    float runtime[VERIFY_COUNT];
+    Sample3DBatch(xs, ys, zs, fixed, VERIFY_COUNT);
+    reference.Sample3DBatch(xs, ys, zs, runtime, VERIFY_COUNT);
+
+    for (int i = 0; i < VERIFY_COUNT; ++i)
+    {
+        float single = Sample3D(xs[i], ys[i], zs[i]);
+        if (std::memcmp(&fixed[i], &runtime[i], sizeof(float)) != 0 || std::memcmp(&single, &runtime[i], sizeof(float)) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// One instantiation per traits type (the SIMD entry points are instantiated in their own translation units)
+template class FixedBatchPerlinNoise<DensityNoiseTraits>;
@@ -0,0 +1,168 @@
+#pragma once
+#include "FractalNoiseTraits.hpp"
+#include <cstdint>
+
+// SSE4.1 / AVX2 kernels are only compiled for x86 targets; other platforms use the scalar path
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define BATCH_NOISE_HAS_X86_SIMD 1
+#else
+#define BATCH_NOISE_HAS_X86_SIMD 0
+#endif
+
+/**
+ * @brief Instruction set used by the batch noise kernels
+ */
+enum class NoiseSimdLevel : uint8_t
+{
+    Scalar = 0,
+    SSE41  = 1, // 4 lanes
+    AVX2   = 2 // 8 lanes
+};
+
+/**
+ * @brief Fractal Perlin noise with batch sampling (rows, columns, point lists)
+ *
+ * Game-side gradient noise used by SimpleMinerGenerator when batch noise is enabled.
+ * Follows the same fractal layout as the engine's SmoothNoise Perlin (per-octave seed
+ * increment, irrational octave offset, SmoothStep3 renormalization) but uses a
+ * Squirrel5 lattice hash with sign-bit gradients so every lane can be evaluated without
+ * table gathers.
+ *
+ * The scalar, SSE4.1 and AVX2 paths are generated from one kernel template and execute
+ * the same float operations in the same order, so all three return bit-identical results.
+ * Do not build the kernels with FMA contraction enabled (-ffp-contract=fast with -mfma,
+ * /fp:contract), otherwise the scalar path may fuse operations the SIMD paths do not.
+ *
+ * Thread-safe: all sampling methods are const and use no shared mutable state.
+ */
+class BatchPerlinNoise
+{
+public:
+    static constexpr unsigned int MAX_OCTAVES = 16;
+
+    /**
+     * @brief Immutable parameters shared with the SIMD kernels
+     */
+    struct Params
+    {
+        uint32_t     seed           = 0;
+        float        invScale       = 1.0f;
+        unsigned int octaves        = 1;
+        float        octaveScale    = 2.0f;
+        bool         renormalize    = true;
+        float        totalAmplitude = 1.0f; // Sum of all octave amplitudes
+        float        amplitudes[MAX_OCTAVES] = {}; // persistence^octave
+    };
+
+    /**
+     * @brief Constructor (same parameter order as PerlinNoiseGenerator)
+     * @param seed Noise seed; octave N uses seed + N
+     * @param scale Feature size in blocks
+     * @param octaves Number of octaves (clamped to MAX_OCTAVES)
+     * @param persistence Amplitude multiplier per octave
+     * @param octaveScale Frequency multiplier per octave
+     * @param renormalize Map the octave sum back to [-1, 1]
+     */
+    BatchPerlinNoise(uint32_t seed, float scale, unsigned int octaves,
+                     float    persistence = 0.5f, float octaveScale = 2.0f, bool renormalize = true);
+
+    // ========== Single Point ==========
+    float Sample2D(float x, float y) const;
+    float Sample3D(float x, float y, float z) const;
+
+    // ========== Batch Sampling ==========
+
+    /**
+     * @brief Sample arbitrary 2D points (xs[i], ys[i]) into out[i]
+     */
+    void Sample2DBatch(const float* xs, const float* ys, float* out, int count) const;
+
+    /**
+     * @brief Sample arbitrary 3D points (xs[i], ys[i], zs[i]) into out[i]
+     */
+    void Sample3DBatch(const float* xs, const float* ys, const float* zs, float* out, int count) const;
+
+    /**
+     * @brief Sample count points along X: (startX + i * stepX, y)
+     */
+    void Sample2DRow(float startX, float stepX, float y, float* out, int count) const;
+
+    /**
+     * @brief Sample count points along X: (startX + i * stepX, y, z)
+     */
+    void Sample3DRow(float startX, float stepX, float y, float z, float* out, int count) const;
+
+    /**
+     * @brief Sample count points along Z: (x, y, startZ + i * stepZ)
+     */
+    void Sample3DColumn(float x, float y, float startZ, float stepZ, float* out, int count) const;
+
+    // ========== SIMD Dispatch ==========
+
+    /**
+     * @brief Force a kernel (clamped to what the CPU supports)
+     */
+    void SetSimdLevel(NoiseSimdLevel level);
+
+    NoiseSimdLevel GetSimdLevel() const { return m_simdLevel; }
+    const Params&  GetParams() const { return m_params; }
+
+    /**
+     * @brief Best instruction set supported by this CPU (and compiled into this build)
+     */
+    static NoiseSimdLevel DetectSimdLevel();
+
+    static const char* GetSimdLevelName(NoiseSimdLevel level);
+
+    /**
+     * @brief Compare the given kernel against the scalar path on a fixed point set
+     * @return true if every sample is bit-identical
+     */
+    bool VerifySimdLevel(NoiseSimdLevel level) const;
+
+private:
+    Params         m_params;
+    NoiseSimdLevel m_simdLevel = NoiseSimdLevel::Scalar;
+};
+
+/**
+ * @brief 3D fractal Perlin noise with parameters fixed at compile time
+ *
+ * Same kernel and lattice as BatchPerlinNoise, instantiated with a FractalNoiseTraits type
+ * instead of runtime Params: the octave loop is unrolled and all per-octave constants are
+ * folded. Samples are bit-identical to a BatchPerlinNoise built with the same values
+ * (checked by VerifyAgainst()). Use BatchPerlinNoise when parameters need to be tuned at runtime.
+ *
+ * Instantiated in BatchPerlinNoise.cpp / BatchPerlinNoiseSSE41.cpp / BatchPerlinNoiseAVX2.cpp;
+ * a new traits type needs an explicit instantiation in all three.
+ *
+ * Thread-safe: all sampling methods are const and use no shared mutable state.
+ */
+template <typename Traits>
+class FixedBatchPerlinNoise
+{
+public:
+    explicit FixedBatchPerlinNoise(uint32_t seed);
+
+    float Sample3D(float x, float y, float z) const;
+    void  Sample3DBatch(const float* xs, const float* ys, const float* zs, float* out, int count) const;
+    void  Sample3DRow(float startX, float stepX, float y, float z, float* out, int count) const;
+    void  Sample3DColumn(float x, float y, float startZ, float stepZ, float* out, int count) const;
+
+    /**
+     * @brief Force a kernel (clamped to what the CPU supports)
+     */
+    void SetSimdLevel(NoiseSimdLevel level);
+
+    NoiseSimdLevel GetSimdLevel() const { return m_simdLevel; }
+
+    /**
+     * @brief Compare against a runtime-parameter noise on the BatchPerlinNoise verification point set
+     * @return true if every sample is bit-identical
+     */
+    bool VerifyAgainst(const BatchPerlinNoise& reference) const;
+
+private:
+    uint32_t       m_seed      = 0;
+    NoiseSimdLevel m_simdLevel = NoiseSimdLevel::Scalar;
+};
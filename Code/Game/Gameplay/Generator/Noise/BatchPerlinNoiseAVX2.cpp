@@ -0,0 +1,91 @@
+//-----------------------------------------------------------------------------------------------
+// BatchPerlinNoiseAVX2.cpp
+// 8-lane AVX2 instantiation of the batch Perlin kernels.
+// Only called after BatchPerlinNoise::DetectSimdLevel() confirmed AVX2 support.
+//-----------------------------------------------------------------------------------------------
+#include "BatchPerlinNoise.hpp"
+
+#if BATCH_NOISE_HAS_X86_SIMD
+#include <immintrin.h>
+
+// Enable AVX2 for this translation unit only (MSVC allows the intrinsics without /arch)
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+
+#include "BatchPerlinNoiseKernels.hpp"
+
+namespace BatchNoiseKernels
+{
+    struct Avx2Lanes
+    {
+        static constexpr int WIDTH = 8;
+        using Float                = __m256;
+        using Int                  = __m256i;
+
+        static Float Load(const float* p) { return _mm256_loadu_ps(p); }
+        static void  Store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+        static Float Set(float v) { return _mm256_set1_ps(v); }
+        static Int   SetInt(uint32_t v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+
+        static Float Add(Float a, Float b) { return _mm256_add_ps(a, b); }
+        static Float Sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+        static Float Mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+        static Float Div(Float a, Float b) { return _mm256_div_ps(a, b); }
+        static Float Min(Float a, Float b) { return _mm256_min_ps(a, b); }
+        static Float Max(Float a, Float b) { return _mm256_max_ps(a, b); }
+        static Float Floor(Float v) { return _mm256_floor_ps(v); }
+        static Int   FloatToInt(Float v) { return _mm256_cvttps_epi32(v); }
+
+        static Int IntAdd(Int a, Int b) { return _mm256_add_epi32(a, b); }
+        static Int IntMul(Int a, Int b) { return _mm256_mullo_epi32(a, b); }
+        static Int IntXor(Int a, Int b) { return _mm256_xor_si256(a, b); }
+
+        template <int N>
+        static Int ShiftRight(Int v) { return _mm256_srli_epi32(v, N); }
+
+        static Float SelectByBit(Int hash, uint32_t mask, Float ifSet, Float ifClear)
+        {
+            Int maskV    = SetInt(mask);
+            Int selected = _mm256_cmpeq_epi32(_mm256_and_si256(hash, maskV), maskV);
+            return _mm256_blendv_ps(ifClear, ifSet, _mm256_castsi256_ps(selected));
+        }
+
+        template <int BIT>
+        static Float NegateIfBit(Float v, Int hash)
+        {
+            Int sign = _mm256_and_si256(_mm256_slli_epi32(hash, 31 - BIT), SetInt(0x80000000u));
+            return _mm256_xor_ps(v, _mm256_castsi256_ps(sign));
+        }
+    };
+
+    int SampleBatch2D_AVX2(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, float* out, int count)
+    {
+        return SampleBatch2D<Avx2Lanes>(params, xs, ys, out, count);
+    }
+
+    int SampleBatch3D_AVX2(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, const float* zs, float* out, int count)
+    {
+        return SampleBatch3D<Avx2Lanes>(params, xs, ys, zs, out, count);
+    }
+
+    template <typename Traits>
+    int SampleFixedBatch3D_AVX2(uint32_t seed, const float* xs, const float* ys, const float* zs, float* out, int count)
+    {
+        return SampleFixedBatch3D<Avx2Lanes, Traits>(seed, xs, ys, zs, out, count);
+    }
+
+    // One instantiation per FixedBatchPerlinNoise traits type
+    template int SampleFixedBatch3D_AVX2<DensityNoiseTraits>(uint32_t, const float*, const float*, const float*, float*, int);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // BATCH_NOISE_HAS_X86_SIMD
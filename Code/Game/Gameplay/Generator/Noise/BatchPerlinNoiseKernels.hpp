@@ -0,0 +1,336 @@
+#pragma once
+//-----------------------------------------------------------------------------------------------
+// BatchPerlinNoiseKernels.hpp
+// Lane-generic fractal Perlin kernels shared by the scalar, SSE4.1 and AVX2 translation units.
+//
+// Include order matters: every translation unit must include BatchPerlinNoise.hpp and all
+// standard headers BEFORE enabling its target pragma and including this file. Everything in
+// here is a template on the lane type, so each instruction set gets its own instantiation and
+// no inline function compiled for AVX2 can be merged into the scalar build by the linker
+// (the parameter policies below take the lane type for the same reason).
+//-----------------------------------------------------------------------------------------------
+
+namespace BatchNoiseKernels
+{
+    // Squirrel5 bit noise constants
+    constexpr uint32_t SQ5_BIT_NOISE1 = 0xd2a80a3fu;
+    constexpr uint32_t SQ5_BIT_NOISE2 = 0xa884f197u;
+    constexpr uint32_t SQ5_BIT_NOISE3 = 0x6C736F4Bu;
+    constexpr uint32_t SQ5_BIT_NOISE4 = 0xB79F3ABBu;
+    constexpr uint32_t SQ5_BIT_NOISE5 = 0x1b56c4f5u;
+
+    // Large primes with non-boring bits used to fold 2D/3D lattice coordinates into one index
+    constexpr uint32_t PRIME_Y = 198491317u;
+    constexpr uint32_t PRIME_Z = 6542989u;
+
+    // "Irrational" translation added between octaves to de-align octave lattices
+    constexpr float OCTAVE_OFFSET = 0.636764989593174f;
+
+    // Gradient components. 2D uses the 8 directions (±A, ±B) / (±B, ±A), 3D the 8 cube diagonals
+    constexpr float GRADIENT_2D_MAJOR = 0.923879533f;
+    constexpr float GRADIENT_2D_MINOR = 0.382683432f;
+    constexpr float GRADIENT_3D       = 0.577350269f;
+
+    // Unit-gradient Perlin noise is bounded by sqrt(n) / 2; scale each octave back to [-1, 1]
+    constexpr float NORMALIZE_2D = 1.41421356f;
+    constexpr float NORMALIZE_3D = 1.15470054f;
+
+    template <typename L>
+    typename L::Int SquirrelHash(typename L::Int position, typename L::Int seed)
+    {
+        typename L::Int bits = L::IntMul(position, L::SetInt(SQ5_BIT_NOISE1));
+        bits                 = L::IntAdd(bits, seed);
+        bits                 = L::IntXor(bits, L::template ShiftRight<9>(bits));
+        bits                 = L::IntAdd(bits, L::SetInt(SQ5_BIT_NOISE2));
+        bits                 = L::IntXor(bits, L::template ShiftRight<11>(bits));
+        bits                 = L::IntMul(bits, L::SetInt(SQ5_BIT_NOISE3));
+        bits                 = L::IntXor(bits, L::template ShiftRight<13>(bits));
+        bits                 = L::IntAdd(bits, L::SetInt(SQ5_BIT_NOISE4));
+        bits                 = L::IntXor(bits, L::template ShiftRight<15>(bits));
+        bits                 = L::IntMul(bits, L::SetInt(SQ5_BIT_NOISE5));
+        bits                 = L::IntXor(bits, L::template ShiftRight<17>(bits));
+        return bits;
+    }
+
+    template <typename L>
+    typename L::Float Lerp(typename L::Float a, typename L::Float b, typename L::Float t)
+    {
+        return L::Add(a, L::Mul(L::Sub(b, a), t));
+    }
+
+    // SmoothStep3: t * t * (3 - 2t)
+    template <typename L>
+    typename L::Float Fade(typename L::Float t)
+    {
+        return L::Mul(L::Mul(t, t), L::Sub(L::Set(3.0f), L::Mul(L::Set(2.0f), t)));
+    }
+
+    template <typename L>
+    typename L::Float Gradient2D(typename L::Int hash, typename L::Float dx, typename L::Float dy)
+    {
+        // bit 0 swaps major/minor axis, bit 1 negates X, bit 2 negates Y
+        typename L::Float gx = L::SelectByBit(hash, 1u, L::Set(GRADIENT_2D_MINOR), L::Set(GRADIENT_2D_MAJOR));
+        typename L::Float gy = L::SelectByBit(hash, 1u, L::Set(GRADIENT_2D_MAJOR), L::Set(GRADIENT_2D_MINOR));
+        gx                   = L::template NegateIfBit<1>(gx, hash);
+        gy                   = L::template NegateIfBit<2>(gy, hash);
+        return L::Add(L::Mul(gx, dx), L::Mul(gy, dy));
+    }
+
+    template <typename L>
+    typename L::Float Gradient3D(typename L::Int hash, typename L::Float dx, typename L::Float dy, typename L::Float dz)
+    {
+        // bit 0/1/2 negate X/Y/Z of the (+k, +k, +k) cube diagonal
+        typename L::Float k  = L::Set(GRADIENT_3D);
+        typename L::Float gx = L::template NegateIfBit<0>(k, hash);
+        typename L::Float gy = L::template NegateIfBit<1>(k, hash);
+        typename L::Float gz = L::template NegateIfBit<2>(k, hash);
+        return L::Add(L::Add(L::Mul(gx, dx), L::Mul(gy, dy)), L::Mul(gz, dz));
+    }
+
+    /**
+     * @brief Fractal parameters read from BatchPerlinNoise::Params at runtime
+     */
+    template <typename L>
+    struct RuntimeFractal
+    {
+        const BatchPerlinNoise::Params& params;
+
+        uint32_t     Seed() const { return params.seed; }
+        unsigned int Octaves() const { return params.octaves; }
+        float        InvScale() const { return params.invScale; }
+        float        OctaveScale() const { return params.octaveScale; }
+        float        Amplitude(unsigned int octave) const { return params.amplitudes[octave]; }
+        bool         Renormalize() const { return params.renormalize; }
+        float        TotalAmplitude() const { return params.totalAmplitude; }
+    };
+
+    /**
+     * @brief Fractal parameters fixed at compile time by a FractalNoiseTraits type
+     *
+     * Only the seed is a runtime value; the octave loop bound, 1 / scale and amplitudes are
+     * constants, so the compiler can unroll the octaves and fold the per-octave constants.
+     */
+    template <typename L, typename Traits>
+    struct FixedFractal
+    {
+        uint32_t seed;
+
+        uint32_t                      Seed() const { return seed; }
+        static constexpr unsigned int Octaves() { return Traits::OCTAVES; }
+        static constexpr float        InvScale() { return Traits::INV_SCALE; }
+        static constexpr float        OctaveScale() { return Traits::OCTAVE_SCALE; }
+        static constexpr float        Amplitude(unsigned int octave) { return Traits::Amplitude(octave); }
+        static constexpr bool         Renormalize() { return Traits::RENORMALIZE; }
+        static constexpr float        TotalAmplitude() { return Traits::TotalAmplitude(); }
+    };
+
+    template <typename L, typename P>
+    typename L::Float Renormalize(const P& fractal, typename L::Float total)
+    {
+        if (!fractal.Renormalize() || fractal.TotalAmplitude() <= 0.0f)
+        {
+            return total;
+        }
+
+        // Kept as a division (not a folded reciprocal) so both parameter sources stay bit-identical
+        typename L::Float t = L::Div(total, L::Set(fractal.TotalAmplitude())); // [-1, 1]
+        t                   = L::Add(L::Mul(t, L::Set(0.5f)), L::Set(0.5f)); // [0, 1]
+        t                   = Fade<L>(t); // Push towards extents (octaves pull us away)
+        t                   = L::Sub(L::Mul(t, L::Set(2.0f)), L::Set(1.0f)); // [-1, 1]
+        return L::Min(L::Max(t, L::Set(-1.0f)), L::Set(1.0f));
+    }
+
+    template <typename L, typename P>
+    typename L::Float FractalSum2D(const P& fractal, typename L::Float x, typename L::Float y)
+    {
+        using Float = typename L::Float;
+        using Int   = typename L::Int;
+
+        const Float one = L::Set(1.0f);
+        const Int   oneI = L::SetInt(1u);
+
+        Float px    = L::Mul(x, L::Set(fractal.InvScale()));
+        Float py    = L::Mul(y, L::Set(fractal.InvScale()));
+        Float total = L::Set(0.0f);
+
+        for (unsigned int octave = 0; octave < fractal.Octaves(); ++octave)
+        {
+            Float cellX = L::Floor(px);
+            Float cellY = L::Floor(py);
+            Int   ix0   = L::FloatToInt(cellX);
+            Int   iy0   = L::FloatToInt(cellY);
+            Int   ix1   = L::IntAdd(ix0, oneI);
+            Int   iy1   = L::IntAdd(iy0, oneI);
+
+            Int rowY0 = L::IntMul(iy0, L::SetInt(PRIME_Y));
+            Int rowY1 = L::IntMul(iy1, L::SetInt(PRIME_Y));
+            Int seed  = L::SetInt(fractal.Seed() + octave);
+
+            Int h00 = SquirrelHash<L>(L::IntAdd(ix0, rowY0), seed);
+            Int h10 = SquirrelHash<L>(L::IntAdd(ix1, rowY0), seed);
+            Int h01 = SquirrelHash<L>(L::IntAdd(ix0, rowY1), seed);
+            Int h11 = SquirrelHash<L>(L::IntAdd(ix1, rowY1), seed);
+
+            Float dx0 = L::Sub(px, cellX);
+            Float dy0 = L::Sub(py, cellY);
+            Float dx1 = L::Sub(dx0, one);
+            Float dy1 = L::Sub(dy0, one);
+
+            Float d00 = Gradient2D<L>(h00, dx0, dy0);
+            Float d10 = Gradient2D<L>(h10, dx1, dy0);
+            Float d01 = Gradient2D<L>(h01, dx0, dy1);
+            Float d11 = Gradient2D<L>(h11, dx1, dy1);
+
+            Float wx = Fade<L>(dx0);
+            Float wy = Fade<L>(dy0);
+
+            Float blend = Lerp<L>(Lerp<L>(d00, d10, wx), Lerp<L>(d01, d11, wx), wy);
+            Float value = L::Mul(blend, L::Set(NORMALIZE_2D));
+            total       = L::Add(total, L::Mul(value, L::Set(fractal.Amplitude(octave))));
+
+            px = L::Add(L::Mul(px, L::Set(fractal.OctaveScale())), L::Set(OCTAVE_OFFSET));
+            py = L::Add(L::Mul(py, L::Set(fractal.OctaveScale())), L::Set(OCTAVE_OFFSET));
+        }
+
+        return Renormalize<L>(fractal, total);
+    }
+
+    template <typename L, typename P>
+    typename L::Float FractalSum3D(const P& fractal, typename L::Float x, typename L::Float y, typename L::Float z)
+    {
+        using Float = typename L::Float;
+        using Int   = typename L::Int;
+
+        const Float one  = L::Set(1.0f);
+        const Int   oneI = L::SetInt(1u);
+
+        Float px    = L::Mul(x, L::Set(fractal.InvScale()));
+        Float py    = L::Mul(y, L::Set(fractal.InvScale()));
+        Float pz    = L::Mul(z, L::Set(fractal.InvScale()));
+        Float total = L::Set(0.0f);
+
+        for (unsigned int octave = 0; octave < fractal.Octaves(); ++octave)
+        {
+            Float cellX = L::Floor(px);
+            Float cellY = L::Floor(py);
+            Float cellZ = L::Floor(pz);
+            Int   ix0   = L::FloatToInt(cellX);
+            Int   iy0   = L::FloatToInt(cellY);
+            Int   iz0   = L::FloatToInt(cellZ);
+            Int   ix1   = L::IntAdd(ix0, oneI);
+
+            Int rowY0 = L::IntMul(iy0, L::SetInt(PRIME_Y));
+            Int rowY1 = L::IntMul(L::IntAdd(iy0, oneI), L::SetInt(PRIME_Y));
+            Int layZ0 = L::IntMul(iz0, L::SetInt(PRIME_Z));
+            Int layZ1 = L::IntMul(L::IntAdd(iz0, oneI), L::SetInt(PRIME_Z));
+            Int seed  = L::SetInt(fractal.Seed() + octave);
+
+            Int base00 = L::IntAdd(rowY0, layZ0);
+            Int base10 = L::IntAdd(rowY1, layZ0);
+            Int base01 = L::IntAdd(rowY0, layZ1);
+            Int base11 = L::IntAdd(rowY1, layZ1);
+
+            Int h000 = SquirrelHash<L>(L::IntAdd(ix0, base00), seed);
+            Int h100 = SquirrelHash<L>(L::IntAdd(ix1, base00), seed);
+            Int h010 = SquirrelHash<L>(L::IntAdd(ix0, base10), seed);
+            Int h110 = SquirrelHash<L>(L::IntAdd(ix1, base10), seed);
+            Int h001 = SquirrelHash<L>(L::IntAdd(ix0, base01), seed);
+            Int h101 = SquirrelHash<L>(L::IntAdd(ix1, base01), seed);
+            Int h011 = SquirrelHash<L>(L::IntAdd(ix0, base11), seed);
+            Int h111 = SquirrelHash<L>(L::IntAdd(ix1, base11), seed);
+
+            Float dx0 = L::Sub(px, cellX);
+            Float dy0 = L::Sub(py, cellY);
+            Float dz0 = L::Sub(pz, cellZ);
+            Float dx1 = L::Sub(dx0, one);
+            Float dy1 = L::Sub(dy0, one);
+            Float dz1 = L::Sub(dz0, one);
+
+            Float d000 = Gradient3D<L>(h000, dx0, dy0, dz0);
+            Float d100 = Gradient3D<L>(h100, dx1, dy0, dz0);
+            Float d010 = Gradient3D<L>(h010, dx0, dy1, dz0);
+            Float d110 = Gradient3D<L>(h110, dx1, dy1, dz0);
+            Float d001 = Gradient3D<L>(h001, dx0, dy0, dz1);
+            Float d101 = Gradient3D<L>(h101, dx1, dy0, dz1);
+            Float d011 = Gradient3D<L>(h011, dx0, dy1, dz1);
+            Float d111 = Gradient3D<L>(h111, dx1, dy1, dz1);
+
+            Float wx = Fade<L>(dx0);
+            Float wy = Fade<L>(dy0);
+            Float wz = Fade<L>(dz0);
+
+            Float below = Lerp<L>(Lerp<L>(d000, d100, wx), Lerp<L>(d010, d110, wx), wy);
+            Float above = Lerp<L>(Lerp<L>(d001, d101, wx), Lerp<L>(d011, d111, wx), wy);
+            Float value = L::Mul(Lerp<L>(below, above, wz), L::Set(NORMALIZE_3D));
+            total       = L::Add(total, L::Mul(value, L::Set(fractal.Amplitude(octave))));
+
+            px = L::Add(L::Mul(px, L::Set(fractal.OctaveScale())), L::Set(OCTAVE_OFFSET));
+            py = L::Add(L::Mul(py, L::Set(fractal.OctaveScale())), L::Set(OCTAVE_OFFSET));
+            pz = L::Add(L::Mul(pz, L::Set(fractal.OctaveScale())), L::Set(OCTAVE_OFFSET));
+        }
+
+        return Renormalize<L>(fractal, total);
+    }
+
+    template <typename L>
+    typename L::Float Fractal2D(const BatchPerlinNoise::Params& params, typename L::Float x, typename L::Float y)
+    {
+        return FractalSum2D<L>(RuntimeFractal<L>{params}, x, y);
+    }
+
+    template <typename L>
+    typename L::Float Fractal3D(const BatchPerlinNoise::Params& params, typename L::Float x, typename L::Float y, typename L::Float z)
+    {
+        return FractalSum3D<L>(RuntimeFractal<L>{params}, x, y, z);
+    }
+
+    /**
+     * @brief Run the kernel over whole lane groups
+     * @return Number of points processed (a multiple of L::WIDTH); the caller finishes the tail
+     */
+    template <typename L>
+    int SampleBatch2D(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, float* out, int count)
+    {
+        int i = 0;
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            L::Store(out + i, Fractal2D<L>(params, L::Load(xs + i), L::Load(ys + i)));
+        }
+        return i;
+    }
+
+    template <typename L>
+    int SampleBatch3D(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, const float* zs, float* out, int count)
+    {
+        int i = 0;
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            L::Store(out + i, Fractal3D<L>(params, L::Load(xs + i), L::Load(ys + i), L::Load(zs + i)));
+        }
+        return i;
+    }
+
+    template <typename L, typename Traits>
+    int SampleFixedBatch3D(uint32_t seed, const float* xs, const float* ys, const float* zs, float* out, int count)
+    {
+        const FixedFractal<L, Traits> fractal{seed};
+        int                           i = 0;
+        for (; i + L::WIDTH <= count; i += L::WIDTH)
+        {
+            L::Store(out + i, FractalSum3D<L>(fractal, L::Load(xs + i), L::Load(ys + i), L::Load(zs + i)));
+        }
+        return i;
+    }
+
+    // SIMD entry points (defined in BatchPerlinNoiseSSE41.cpp / BatchPerlinNoiseAVX2.cpp)
+    int SampleBatch2D_SSE41(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, float* out, int count);
+    int SampleBatch3D_SSE41(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, const float* zs, float* out, int count);
+    int SampleBatch2D_AVX2(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, float* out, int count);
+    int SampleBatch3D_AVX2(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, const float* zs, float* out, int count);
+
+    // Compile-time parameter entry points, explicitly instantiated per traits type in each SIMD translation unit
+    template <typename Traits>
+    int SampleFixedBatch3D_SSE41(uint32_t seed, const float* xs, const float* ys, const float* zs, float* out, int count);
+    template <typename Traits>
+    int SampleFixedBatch3D_AVX2(uint32_t seed, const float* xs, const float* ys, const float* zs, float* out, int count);
+}
@@ -0,0 +1,91 @@
+//-----------------------------------------------------------------------------------------------
+// BatchPerlinNoiseSSE41.cpp
+// 4-lane SSE4.1 instantiation of the batch Perlin kernels.
+// Only called after BatchPerlinNoise::DetectSimdLevel() confirmed SSE4.1 support.
+//-----------------------------------------------------------------------------------------------
+#include "BatchPerlinNoise.hpp"
+
+#if BATCH_NOISE_HAS_X86_SIMD
+#include <immintrin.h>
+
+// Enable SSE4.1 for this translation unit only (MSVC allows the intrinsics without /arch)
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse4.1"))), apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("sse4.1")
+#endif
+
+#include "BatchPerlinNoiseKernels.hpp"
+
+namespace BatchNoiseKernels
+{
+    struct Sse41Lanes
+    {
+        static constexpr int WIDTH = 4;
+        using Float                = __m128;
+        using Int                  = __m128i;
+
+        static Float Load(const float* p) { return _mm_loadu_ps(p); }
+        static void  Store(float* p, Float v) { _mm_storeu_ps(p, v); }
+        static Float Set(float v) { return _mm_set1_ps(v); }
+        static Int   SetInt(uint32_t v) { return _mm_set1_epi32(static_cast<int>(v)); }
+
+        static Float Add(Float a, Float b) { return _mm_add_ps(a, b); }
+        static Float Sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+        static Float Mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+        static Float Div(Float a, Float b) { return _mm_div_ps(a, b); }
+        static Float Min(Float a, Float b) { return _mm_min_ps(a, b); }
+        static Float Max(Float a, Float b) { return _mm_max_ps(a, b); }
+        static Float Floor(Float v) { return _mm_floor_ps(v); }
+        static Int   FloatToInt(Float v) { return _mm_cvttps_epi32(v); }
+
+        static Int IntAdd(Int a, Int b) { return _mm_add_epi32(a, b); }
+        static Int IntMul(Int a, Int b) { return _mm_mullo_epi32(a, b); }
+        static Int IntXor(Int a, Int b) { return _mm_xor_si128(a, b); }
+
+        template <int N>
+        static Int ShiftRight(Int v) { return _mm_srli_epi32(v, N); }
+
+        static Float SelectByBit(Int hash, uint32_t mask, Float ifSet, Float ifClear)
+        {
+            Int maskV    = SetInt(mask);
+            Int selected = _mm_cmpeq_epi32(_mm_and_si128(hash, maskV), maskV);
+            return _mm_blendv_ps(ifClear, ifSet, _mm_castsi128_ps(selected));
+        }
+
+        template <int BIT>
+        static Float NegateIfBit(Float v, Int hash)
+        {
+            Int sign = _mm_and_si128(_mm_slli_epi32(hash, 31 - BIT), SetInt(0x80000000u));
+            return _mm_xor_ps(v, _mm_castsi128_ps(sign));
+        }
+    };
+
+    int SampleBatch2D_SSE41(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, float* out, int count)
+    {
+        return SampleBatch2D<Sse41Lanes>(params, xs, ys, out, count);
+    }
+
+    int SampleBatch3D_SSE41(const BatchPerlinNoise::Params& params, const float* xs, const float* ys, const float* zs, float* out, int count)
+    {
+        return SampleBatch3D<Sse41Lanes>(params, xs, ys, zs, out, count);
+    }
+
+    template <typename Traits>
+    int SampleFixedBatch3D_SSE41(uint32_t seed, const float* xs, const float* ys, const float* zs, float* out, int count)
+    {
+        return SampleFixedBatch3D<Sse41Lanes, Traits>(seed, xs, ys, zs, out, count);
+    }
+
+    // One instantiation per FixedBatchPerlinNoise traits type
+    template int SampleFixedBatch3D_SSE41<DensityNoiseTraits>(uint32_t, const float*, const float*, const float*, float*, int);
+}
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#endif // BATCH_NOISE_HAS_X86_SIMD
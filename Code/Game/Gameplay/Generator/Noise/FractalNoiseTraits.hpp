@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Compile-time fractal Perlin parameters for FixedBatchPerlinNoise
+ *
+ * Mirrors BatchPerlinNoise::Params, but every value is a constant expression so the kernel
+ * instantiated for a traits type has a fixed octave count (unrolled), a folded 1 / scale and
+ * constant octave amplitudes. Amplitudes and their sum are accumulated in the same order as
+ * the BatchPerlinNoise constructor, so both paths produce bit-identical samples.
+ *
+ * Persistence and octave scale are fixed at 0.5 / 2.0 (the values every SimpleMiner noise uses);
+ * the scale is given in whole blocks because float template arguments need C++20.
+ */
+template <unsigned int Octaves, int ScaleBlocks, bool Renormalize = true>
+struct FractalNoiseTraits
+{
+    static_assert(Octaves >= 1 && Octaves <= 16, "Octave count must fit BatchPerlinNoise::MAX_OCTAVES");
+    static_assert(ScaleBlocks > 0, "Noise scale must be positive");
+
+    static constexpr unsigned int OCTAVES      = Octaves;
+    static constexpr float        SCALE        = static_cast<float>(ScaleBlocks);
+    static constexpr float        INV_SCALE    = 1.0f / SCALE;
+    static constexpr float        PERSISTENCE  = 0.5f;
+    static constexpr float        OCTAVE_SCALE = 2.0f;
+    static constexpr bool         RENORMALIZE  = Renormalize;
+
+    static constexpr float Amplitude(unsigned int octave)
+    {
+        float amplitude = 1.0f;
+        for (unsigned int i = 0; i < octave; ++i)
+        {
+            amplitude *= PERSISTENCE;
+        }
+        return amplitude;
+    }
+
+    static constexpr float TotalAmplitude()
+    {
+        float total     = 0.0f;
+        float amplitude = 1.0f;
+        for (unsigned int i = 0; i < OCTAVES; ++i)
+        {
+            total += amplitude;
+            amplitude *= PERSISTENCE;
+        }
+        return total;
+    }
+};
+
+// SimpleMinerGenerator 3D density noise (DENSITY_NOISE_OCTAVES / DENSITY_NOISE_SCALE)
+using DensityNoiseTraits = FractalNoiseTraits<8, 64>;
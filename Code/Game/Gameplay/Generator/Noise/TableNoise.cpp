@@ -0,0 +1,447 @@
+#include "TableNoise.hpp"
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+
+namespace
+{
+    // Same irrational translation between octaves as BatchPerlinNoise
+    constexpr float OCTAVE_OFFSET = 0.636764989593174f;
+
+    // Classic improved-Perlin gradient set: 12 cube edges, 4 repeated so a 4-bit index covers it
+    constexpr float GRADIENTS_3D[16][3] = {
+        {1, 1, 0}, {-1, 1, 0}, {1, -1, 0}, {-1, -1, 0},
+        {1, 0, 1}, {-1, 0, 1}, {1, 0, -1}, {-1, 0, -1},
+        {0, 1, 1}, {0, -1, 1}, {0, 1, -1}, {0, -1, -1},
+        {1, 1, 0}, {-1, 1, 0}, {0, -1, 1}, {0, -1, -1},
+    };
+
+    // 8 unit directions, 22.5 degrees off the axes (same set as BatchPerlinNoise)
+    constexpr float GRADIENT_2D_MAJOR   = 0.923879533f;
+    constexpr float GRADIENT_2D_MINOR   = 0.382683432f;
+    constexpr float GRADIENTS_2D[8][2] = {
+        {GRADIENT_2D_MAJOR, GRADIENT_2D_MINOR}, {GRADIENT_2D_MINOR, GRADIENT_2D_MAJOR},
+        {-GRADIENT_2D_MINOR, GRADIENT_2D_MAJOR}, {-GRADIENT_2D_MAJOR, GRADIENT_2D_MINOR},
+        {-GRADIENT_2D_MAJOR, -GRADIENT_2D_MINOR}, {-GRADIENT_2D_MINOR, -GRADIENT_2D_MAJOR},
+        {GRADIENT_2D_MINOR, -GRADIENT_2D_MAJOR}, {GRADIENT_2D_MAJOR, -GRADIENT_2D_MINOR},
+    };
+
+    // Scale each basis back to roughly [-1, 1] (measured maxima over 10^7 random points)
+    constexpr float PERLIN_NORMALIZE_2D         = 1.41421356f;
+    constexpr float PERLIN_NORMALIZE_3D         = 1.0f;
+    constexpr float VALUE_GRADIENT_NORMALIZE_2D = 0.68f;
+    constexpr float VALUE_GRADIENT_NORMALIZE_3D = 0.62f;
+    constexpr float OPEN_SIMPLEX_NORMALIZE_2D   = 99.0f;
+    constexpr float OPEN_SIMPLEX_NORMALIZE_3D   = 32.0f;
+
+    // OpenSimplex2 lattice constants (K. Spencer's reference implementation)
+    constexpr float SKEW_2D     = 0.366025403784439f;
+    constexpr float UNSKEW_2D   = -0.21132486540518713f;
+    constexpr float RSQUARED_2D = 0.5f;
+    constexpr float RSQUARED_3D = 0.6f;
+    constexpr float ROTATE_3D   = 2.0f / 3.0f;
+
+    // Key of the second BCC lattice of OpenSimplex3D
+    constexpr uint8_t SECOND_LATTICE_KEY = 0xA5;
+
+    uint64_t Mix(uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15ull;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+        return value ^ (value >> 31);
+    }
+
+    // SmoothStep3: t * t * (3 - 2t), same fade as BatchPerlinNoise
+    float Fade(float t)
+    {
+        return t * t * (3.0f - 2.0f * t);
+    }
+
+    float Lerp(float a, float b, float t)
+    {
+        return a + (b - a) * t;
+    }
+
+    int32_t FastFloor(float value)
+    {
+        int32_t truncated = static_cast<int32_t>(value);
+        return (value < static_cast<float>(truncated)) ? truncated - 1 : truncated;
+    }
+
+    int32_t FastRound(float value)
+    {
+        return FastFloor(value + 0.5f);
+    }
+}
+
+NoiseGradientTable::NoiseGradientTable(uint32_t worldSeed)
+{
+    // Fisher-Yates shuffle driven by a SplitMix64 stream of the world seed
+    uint8_t  shuffled[256];
+    uint64_t state = Mix(worldSeed);
+    for (int i = 0; i < 256; ++i)
+    {
+        shuffled[i] = static_cast<uint8_t>(i);
+    }
+    for (int i = 255; i > 0; --i)
+    {
+        state     = Mix(state);
+        int other = static_cast<int>(state % static_cast<uint64_t>(i + 1));
+        std::swap(shuffled[i], shuffled[other]);
+    }
+
+    for (int i = 0; i < 256; ++i)
+    {
+        permutation[i]       = shuffled[i];
+        permutation[i + 256] = shuffled[i];
+
+        state     = Mix(state);
+        values[i] = static_cast<float>(state >> 40) * (2.0f / 16777216.0f) - 1.0f;
+    }
+}
+
+TableNoise::TableNoise(const NoiseGradientTable* table, NoiseBasis basis, uint32_t seedOffset, float scale, unsigned int octaves,
+                       float                     persistence, float octaveScale, bool renormalize)
+    : m_table(table)
+      , m_basis(basis)
+      , m_invScale(1.0f / scale)
+      , m_octaves((std::min)(octaves, MAX_OCTAVES))
+      , m_octaveScale(octaveScale)
+      , m_renormalize(renormalize)
+{
+    float amplitude  = 1.0f;
+    m_totalAmplitude = 0.0f;
+    for (unsigned int octave = 0; octave < m_octaves; ++octave)
+    {
+        m_amplitudes[octave] = amplitude;
+        m_totalAmplitude += amplitude;
+        amplitude *= persistence;
+
+        uint64_t bits                = Mix(static_cast<uint64_t>(seedOffset) + octave);
+        m_octaveKeys[octave].offsetX = static_cast<int32_t>(bits & 0xFF);
+        m_octaveKeys[octave].offsetY = static_cast<int32_t>((bits >> 8) & 0xFF);
+        m_octaveKeys[octave].offsetZ = static_cast<int32_t>((bits >> 16) & 0xFF);
+        m_octaveKeys[octave].key     = static_cast<uint8_t>(bits >> 24);
+    }
+}
+
+float TableNoise::Sample2D(float x, float y) const
+{
+    float px    = x * m_invScale;
+    float py    = y * m_invScale;
+    float total = 0.0f;
+    for (unsigned int octave = 0; octave < m_octaves; ++octave)
+    {
+        total += Basis2D(m_octaveKeys[octave], px, py) * m_amplitudes[octave];
+        px = px * m_octaveScale + OCTAVE_OFFSET;
+        py = py * m_octaveScale + OCTAVE_OFFSET;
+    }
+    return Renormalize(total);
+}
+
+float TableNoise::Sample3D(float x, float y, float z) const
+{
+    float px    = x * m_invScale;
+    float py    = y * m_invScale;
+    float pz    = z * m_invScale;
+    float total = 0.0f;
+    for (unsigned int octave = 0; octave < m_octaves; ++octave)
+    {
+        total += Basis3D(m_octaveKeys[octave], px, py, pz) * m_amplitudes[octave];
+        px = px * m_octaveScale + OCTAVE_OFFSET;
+        py = py * m_octaveScale + OCTAVE_OFFSET;
+        pz = pz * m_octaveScale + OCTAVE_OFFSET;
+    }
+    return Renormalize(total);
+}
+
+void TableNoise::Sample2DRow(float startX, float stepX, float y, float* out, int count) const
+{
+    for (int i = 0; i < count; ++i)
+    {
+        out[i] = Sample2D(startX + static_cast<float>(i) * stepX, y);
+    }
+}
+
+void TableNoise::Sample3DRow(float startX, float stepX, float y, float z, float* out, int count) const
+{
+    for (int i = 0; i < count; ++i)
+    {
+        out[i] = Sample3D(startX + static_cast<float>(i) * stepX, y, z);
+    }
+}
+
+void TableNoise::Sample3DColumn(float x, float y, float startZ, float stepZ, float* out, int count) const
+{
+    for (int i = 0; i < count; ++i)
+    {
+        out[i] = Sample3D(x, y, startZ + static_cast<float>(i) * stepZ);
+    }
+}
+
+const char* TableNoise::GetBasisName(NoiseBasis basis)
+{
+    switch (basis)
+    {
+    case NoiseBasis::Perlin: return "perlin";
+    case NoiseBasis::OpenSimplex2: return "opensimplex2";
+    case NoiseBasis::ValueGradient: return "valuegradient";
+    default: return "unknown";
+    }
+}
+
+bool TableNoise::ParseBasis(const std::string& name, NoiseBasis& outBasis)
+{
+    for (NoiseBasis basis : {NoiseBasis::Perlin, NoiseBasis::OpenSimplex2, NoiseBasis::ValueGradient})
+    {
+        if (name == GetBasisName(basis))
+        {
+            outBasis = basis;
+            return true;
+        }
+    }
+    return false;
+}
+
+float TableNoise::Basis2D(const OctaveKey& octave, float x, float y) const
+{
+    switch (m_basis)
+    {
+    case NoiseBasis::OpenSimplex2: return OpenSimplex2D(octave, x, y);
+    case NoiseBasis::ValueGradient: return Perlin2D(octave, x, y, true);
+    default: return Perlin2D(octave, x, y, false);
+    }
+}
+
+float TableNoise::Basis3D(const OctaveKey& octave, float x, float y, float z) const
+{
+    switch (m_basis)
+    {
+    case NoiseBasis::OpenSimplex2: return OpenSimplex3D(octave, x, y, z);
+    case NoiseBasis::ValueGradient: return Perlin3D(octave, x, y, z, true);
+    default: return Perlin3D(octave, x, y, z, false);
+    }
+}
+
+uint8_t TableNoise::Hash2D(const OctaveKey& octave, int32_t x, int32_t y) const
+{
+    const uint8_t* perm = m_table->permutation;
+    return perm[perm[((x + octave.offsetX) & 0xFF) ^ octave.key] + ((y + octave.offsetY) & 0xFF)];
+}
+
+uint8_t TableNoise::Hash3D(const OctaveKey& octave, int32_t x, int32_t y, int32_t z) const
+{
+    const uint8_t* perm = m_table->permutation;
+    return perm[perm[perm[((x + octave.offsetX) & 0xFF) ^ octave.key] + ((y + octave.offsetY) & 0xFF)] + ((z + octave.offsetZ) & 0xFF)];
+}
+
+float TableNoise::Perlin2D(const OctaveKey& octave, float x, float y, bool withValues) const
+{
+    int32_t ix  = FastFloor(x);
+    int32_t iy  = FastFloor(y);
+    float   dx0 = x - static_cast<float>(ix);
+    float   dy0 = y - static_cast<float>(iy);
+    float   dx1 = dx0 - 1.0f;
+    float   dy1 = dy0 - 1.0f;
+
+    float corner[4];
+    const float dxs[4] = {dx0, dx1, dx0, dx1};
+    const float dys[4] = {dy0, dy0, dy1, dy1};
+    for (int i = 0; i < 4; ++i)
+    {
+        uint8_t      hash     = Hash2D(octave, ix + (i & 1), iy + (i >> 1));
+        const float* gradient = GRADIENTS_2D[hash & 7];
+        corner[i]             = gradient[0] * dxs[i] + gradient[1] * dys[i];
+        if (withValues)
+        {
+            corner[i] += m_table->values[hash];
+        }
+    }
+
+    float blend = Lerp(Lerp(corner[0], corner[1], Fade(dx0)), Lerp(corner[2], corner[3], Fade(dx0)), Fade(dy0));
+    return blend * (withValues ? VALUE_GRADIENT_NORMALIZE_2D : PERLIN_NORMALIZE_2D);
+}
+
+float TableNoise::Perlin3D(const OctaveKey& octave, float x, float y, float z, bool withValues) const
+{
+    int32_t ix  = FastFloor(x);
+    int32_t iy  = FastFloor(y);
+    int32_t iz  = FastFloor(z);
+    float   dx0 = x - static_cast<float>(ix);
+    float   dy0 = y - static_cast<float>(iy);
+    float   dz0 = z - static_cast<float>(iz);
+
+    float corner[8];
+    for (int i = 0; i < 8; ++i)
+    {
+        int          cx       = i & 1;
+        int          cy       = (i >> 1) & 1;
+        int          cz       = i >> 2;
+        uint8_t      hash     = Hash3D(octave, ix + cx, iy + cy, iz + cz);
+        const float* gradient = GRADIENTS_3D[hash & 15];
+        corner[i]             = gradient[0] * (dx0 - cx) + gradient[1] * (dy0 - cy) + gradient[2] * (dz0 - cz);
+        if (withValues)
+        {
+            corner[i] += m_table->values[hash];
+        }
+    }
+
+    float wx    = Fade(dx0);
+    float wy    = Fade(dy0);
+    float below = Lerp(Lerp(corner[0], corner[1], wx), Lerp(corner[2], corner[3], wx), wy);
+    float above = Lerp(Lerp(corner[4], corner[5], wx), Lerp(corner[6], corner[7], wx), wy);
+    return Lerp(below, above, Fade(dz0)) * (withValues ? VALUE_GRADIENT_NORMALIZE_3D : PERLIN_NORMALIZE_3D);
+}
+
+float TableNoise::OpenSimplex2D(const OctaveKey& octave, float x, float y) const
+{
+    // Skew onto the triangular lattice, then sum the (up to) three vertices of the containing triangle
+    float   skew = SKEW_2D * (x + y);
+    float   xs   = x + skew;
+    float   ys   = y + skew;
+    int32_t xsb  = FastFloor(xs);
+    int32_t ysb  = FastFloor(ys);
+    float   xi   = xs - static_cast<float>(xsb);
+    float   yi   = ys - static_cast<float>(ysb);
+
+    float t  = (xi + yi) * UNSKEW_2D;
+    float x0 = xi + t;
+    float y0 = yi + t;
+
+    auto contribution = [&](int32_t vertexX, int32_t vertexY, float dx, float dy, float a)
+    {
+        if (a <= 0.0f)
+        {
+            return 0.0f;
+        }
+        const float* gradient = GRADIENTS_2D[Hash2D(octave, vertexX, vertexY) & 7];
+        return (a * a) * (a * a) * (gradient[0] * dx + gradient[1] * dy);
+    };
+
+    float a0    = RSQUARED_2D - x0 * x0 - y0 * y0;
+    float value = contribution(xsb, ysb, x0, y0, a0);
+
+    float a1 = (2.0f * (1.0f + 2.0f * UNSKEW_2D) * (1.0f / UNSKEW_2D + 2.0f)) * t + ((-2.0f * (1.0f + 2.0f * UNSKEW_2D) * (1.0f + 2.0f * UNSKEW_2D)) + a0);
+    float x1 = x0 - (1.0f + 2.0f * UNSKEW_2D);
+    float y1 = y0 - (1.0f + 2.0f * UNSKEW_2D);
+    value += contribution(xsb + 1, ysb + 1, x1, y1, a1);
+
+    if (y0 > x0)
+    {
+        float x2 = x0 - UNSKEW_2D;
+        float y2 = y0 - (UNSKEW_2D + 1.0f);
+        value += contribution(xsb, ysb + 1, x2, y2, RSQUARED_2D - x2 * x2 - y2 * y2);
+    }
+    else
+    {
+        float x2 = x0 - (UNSKEW_2D + 1.0f);
+        float y2 = y0 - UNSKEW_2D;
+        value += contribution(xsb + 1, ysb, x2, y2, RSQUARED_2D - x2 * x2 - y2 * y2);
+    }
+    return value * OPEN_SIMPLEX_NORMALIZE_2D;
+}
+
+float TableNoise::OpenSimplex3D(const OctaveKey& octave, float x, float y, float z) const
+{
+    // Rotate so the BCC lattice's main diagonal points along (1, 1, 1), as the reference fallback orientation
+    float rotation = ROTATE_3D * (x + y + z);
+    float xr       = rotation - x;
+    float yr       = rotation - y;
+    float zr       = rotation - z;
+
+    // Two interleaved cubic lattices form the BCC lattice; each contributes its nearest vertex and one neighbour
+    int32_t xrb = FastRound(xr);
+    int32_t yrb = FastRound(yr);
+    int32_t zrb = FastRound(zr);
+    float   xri = xr - static_cast<float>(xrb);
+    float   yri = yr - static_cast<float>(yrb);
+    float   zri = zr - static_cast<float>(zrb);
+
+    int   xNSign = (xri < 0.0f) ? 1 : -1;
+    int   yNSign = (yri < 0.0f) ? 1 : -1;
+    int   zNSign = (zri < 0.0f) ? 1 : -1;
+    float ax0    = static_cast<float>(xNSign) * -xri;
+    float ay0    = static_cast<float>(yNSign) * -yri;
+    float az0    = static_cast<float>(zNSign) * -zri;
+
+    OctaveKey lattice = octave;
+    float     value   = 0.0f;
+    float     a       = (RSQUARED_3D - xri * xri) - (yri * yri + zri * zri);
+
+    auto contribution = [&](int32_t vertexX, int32_t vertexY, int32_t vertexZ, float dx, float dy, float dz, float falloff)
+    {
+        const float* gradient = GRADIENTS_3D[Hash3D(lattice, vertexX, vertexY, vertexZ) & 15];
+        return (falloff * falloff) * (falloff * falloff) * (gradient[0] * dx + gradient[1] * dy + gradient[2] * dz);
+    };
+
+    for (int latticeIndex = 0;; ++latticeIndex)
+    {
+        if (a > 0.0f)
+        {
+            value += contribution(xrb, yrb, zrb, xri, yri, zri, a);
+        }
+
+        if (ax0 >= ay0 && ax0 >= az0)
+        {
+            float b = a + ax0 + ax0;
+            if (b > 1.0f)
+            {
+                value += contribution(xrb - xNSign, yrb, zrb, xri + xNSign, yri, zri, b - 1.0f);
+            }
+        }
+        else if (ay0 > ax0 && ay0 >= az0)
+        {
+            float b = a + ay0 + ay0;
+            if (b > 1.0f)
+            {
+                value += contribution(xrb, yrb - yNSign, zrb, xri, yri + yNSign, zri, b - 1.0f);
+            }
+        }
+        else
+        {
+            float b = a + az0 + az0;
+            if (b > 1.0f)
+            {
+                value += contribution(xrb, yrb, zrb - zNSign, xri, yri, zri + zNSign, b - 1.0f);
+            }
+        }
+
+        if (latticeIndex == 1)
+        {
+            break;
+        }
+
+        // Move to the second lattice (offset by half a cell)
+        ax0 = 0.5f - ax0;
+        ay0 = 0.5f - ay0;
+        az0 = 0.5f - az0;
+        xri = static_cast<float>(xNSign) * ax0;
+        yri = static_cast<float>(yNSign) * ay0;
+        zri = static_cast<float>(zNSign) * az0;
+        a += (0.75f - ax0) - (ay0 + az0);
+
+        xrb += (xNSign < 0) ? 1 : 0;
+        yrb += (yNSign < 0) ? 1 : 0;
+        zrb += (zNSign < 0) ? 1 : 0;
+        xNSign = -xNSign;
+        yNSign = -yNSign;
+        zNSign = -zNSign;
+        lattice.key ^= SECOND_LATTICE_KEY;
+    }
+    return value * OPEN_SIMPLEX_NORMALIZE_3D;
+}
+
+float TableNoise::Renormalize(float total) const
+{
+    if (!m_renormalize || m_totalAmplitude <= 0.0f)
+    {
+        return total;
+    }
+
+    float t = total / m_totalAmplitude; // [-1, 1]
+    t       = t * 0.5f + 0.5f; // [0, 1]
+    t       = Fade(t); // Push towards extents (octaves pull us away)
+    t       = t * 2.0f - 1.0f; // [-1, 1]
+    return (std::min)((std::max)(t, -1.0f), 1.0f);
+}
@@ -0,0 +1,120 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Lattice noise function evaluated by TableNoise
+ */
+enum class NoiseBasis : uint8_t
+{
+    Perlin = 0, // Classic gradient noise on the cubic lattice
+    OpenSimplex2, // Gradient noise on the simplex (2D) / rotated BCC (3D) lattice, fewer axis-aligned artefacts
+    ValueGradient // Perlin gradients plus a per-vertex value, more low-frequency variation per octave
+};
+
+/**
+ * @brief Permutation and value table shared by every TableNoise of a world
+ *
+ * 512 permutation bytes (two copies, so nested lookups never wrap) and 256 vertex values:
+ * about 1.5 KB, which stays in L1 while all noise channels sample it. Built once per world seed.
+ */
+struct NoiseGradientTable
+{
+    explicit NoiseGradientTable(uint32_t worldSeed);
+
+    uint8_t permutation[512] = {};
+    float   values[256]      = {}; // ValueGradient vertex values in [-1, 1]
+};
+
+/**
+ * @brief Fractal noise on a shared NoiseGradientTable
+ *
+ * Channels (temperature, erosion, density, ...) share one table and differ only by their seed
+ * offset, which selects a per-octave lattice translation and permutation key. Same fractal layout
+ * as BatchPerlinNoise (irrational octave offset, SmoothStep3 renormalization), but the basis is
+ * selectable and the lattice comes from the table instead of a per-vertex hash.
+ *
+ * Scalar only; rows and columns are plain loops. The table must outlive the noise.
+ * Thread-safe: all sampling methods are const and use no shared mutable state.
+ */
+class TableNoise
+{
+public:
+    static constexpr unsigned int MAX_OCTAVES = 16;
+
+    /**
+     * @param table Shared table (not owned)
+     * @param basis Lattice noise function
+     * @param seedOffset Channel seed offset; octave N uses seedOffset + N
+     * @param scale Feature size in blocks
+     * @param octaves Number of octaves (clamped to MAX_OCTAVES)
+     * @param persistence Amplitude multiplier per octave
+     * @param octaveScale Frequency multiplier per octave
+     * @param renormalize Map the octave sum back to [-1, 1]
+     */
+    TableNoise(const NoiseGradientTable* table, NoiseBasis basis, uint32_t seedOffset, float scale, unsigned int octaves,
+               float                     persistence = 0.5f, float octaveScale = 2.0f, bool renormalize = true);
+
+    float Sample2D(float x, float y) const;
+    float Sample3D(float x, float y, float z) const;
+
+    /**
+     * @brief Sample count points along X: (startX + i * stepX, y)
+     */
+    void Sample2DRow(float startX, float stepX, float y, float* out, int count) const;
+
+    /**
+     * @brief Sample count points along X: (startX + i * stepX, y, z)
+     */
+    void Sample3DRow(float startX, float stepX, float y, float z, float* out, int count) const;
+
+    /**
+     * @brief Sample count points along Z: (x, y, startZ + i * stepZ)
+     */
+    void Sample3DColumn(float x, float y, float startZ, float stepZ, float* out, int count) const;
+
+    NoiseBasis GetBasis() const { return m_basis; }
+
+    static const char* GetBasisName(NoiseBasis basis);
+
+    /**
+     * @brief "perlin", "opensimplex2" or "valuegradient"
+     * @return false if the name is not a table noise basis
+     */
+    static bool ParseBasis(const std::string& name, NoiseBasis& outBasis);
+
+private:
+    // Per-octave lattice translation and first-lookup key derived from seedOffset + octave
+    struct OctaveKey
+    {
+        int32_t offsetX = 0;
+        int32_t offsetY = 0;
+        int32_t offsetZ = 0;
+        uint8_t key     = 0;
+    };
+
+    float Basis2D(const OctaveKey& octave, float x, float y) const;
+    float Basis3D(const OctaveKey& octave, float x, float y, float z) const;
+
+    float Perlin2D(const OctaveKey& octave, float x, float y, bool withValues) const;
+    float Perlin3D(const OctaveKey& octave, float x, float y, float z, bool withValues) const;
+    float OpenSimplex2D(const OctaveKey& octave, float x, float y) const;
+    float OpenSimplex3D(const OctaveKey& octave, float x, float y, float z) const;
+
+    uint8_t Hash2D(const OctaveKey& octave, int32_t x, int32_t y) const;
+    uint8_t Hash3D(const OctaveKey& octave, int32_t x, int32_t y, int32_t z) const;
+
+    float Renormalize(float total) const;
+
+    const NoiseGradientTable* m_table = nullptr;
+    NoiseBasis                m_basis = NoiseBasis::Perlin;
+
+    float        m_invScale       = 1.0f;
+    unsigned int m_octaves        = 1;
+    float        m_octaveScale    = 2.0f;
+    bool         m_renormalize    = true;
+    float        m_totalAmplitude = 1.0f;
+
+    float     m_amplitudes[MAX_OCTAVES] = {};
+    OctaveKey m_octaveKeys[MAX_OCTAVES];
+};
@@ -0,0 +1,54 @@
+#include "ProtoChunkStatus.hpp"
+
+const char* GetProtoChunkStatusName(ProtoChunkStatus status)
+{
+    switch (status)
+    {
+    case ProtoChunkStatus::Empty: return "empty";
+    case ProtoChunkStatus::Climate: return "climate";
+    case ProtoChunkStatus::Shape: return "shape";
+    case ProtoChunkStatus::Surface: return "surface";
+    case ProtoChunkStatus::Features: return "features";
+    case ProtoChunkStatus::Full: return "full";
+    default: return "unknown";
+    }
+}
+
+uint64_t ProtoChunkStatusMap::PackKey(int32_t chunkX, int32_t chunkY)
+{
+    return (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkY);
+}
+
+void ProtoChunkStatusMap::Set(int32_t chunkX, int32_t chunkY, ProtoChunkStatus status)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (status == ProtoChunkStatus::Empty || status == ProtoChunkStatus::Full)
+    {
+        m_statuses.erase(PackKey(chunkX, chunkY));
+    }
+    else
+    {
+        m_statuses[PackKey(chunkX, chunkY)] = status;
+    }
+}
+
+ProtoChunkStatus ProtoChunkStatusMap::Get(int32_t chunkX, int32_t chunkY) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto found = m_statuses.find(PackKey(chunkX, chunkY));
+    return found != m_statuses.end() ? found->second : ProtoChunkStatus::Empty;
+}
+
+void ProtoChunkStatusMap::GetStatusCounts(size_t (&outCounts)[static_cast<size_t>(ProtoChunkStatus::Count)]) const
+{
+    for (size_t& count : outCounts)
+    {
+        count = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& entry : m_statuses)
+    {
+        ++outCounts[static_cast<size_t>(entry.second)];
+    }
+}
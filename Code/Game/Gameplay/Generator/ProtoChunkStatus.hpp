@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+/**
+ * @brief How far a chunk has progressed through SimpleMinerGenerator's generation pipeline
+ *
+ * Each stage only reads what the earlier stages produced. Lighting and meshing follow Full on
+ * the engine side (MarkDirty), so they are not stages of their own here.
+ */
+enum class ProtoChunkStatus : uint8_t
+{
+    Empty = 0, // Not started (or not in the pipeline, see ProtoChunkStatusMap)
+    Climate, // Column climate / shape parameters, height bands and the biome map
+    Shape, // Stone / air / water and the surface heightmap
+    Surface, // Biome surface rules (grass, sand, snow, ...)
+    Features, // Trees, caves and ore veins
+    Full, // Committed to the chunk
+    Count
+};
+
+// Stages that do work: Climate..Full
+constexpr size_t PROTO_CHUNK_STAGE_COUNT = static_cast<size_t>(ProtoChunkStatus::Count) - 1;
+
+constexpr size_t ToStageIndex(ProtoChunkStatus status)
+{
+    return static_cast<size_t>(status) - 1;
+}
+
+// Steps of the Features stage, timed separately (a disabled step adds nothing)
+enum class FeatureStep : uint8_t
+{
+    Trees = 0,
+    Caves,
+    OreVeins,
+    Count
+};
+
+constexpr size_t FEATURE_STEP_COUNT = static_cast<size_t>(FeatureStep::Count);
+
+const char* GetProtoChunkStatusName(ProtoChunkStatus status);
+
+/**
+ * @brief Pipeline status of the chunks currently being generated
+ *
+ * Only chunks inside the pipeline have an entry: reaching Full or aborting removes it, so a
+ * finished chunk reads as Empty here and its Chunk::IsGenerated() is the authority.
+ *
+ * Thread-safe; ChunkGen threads update it at every stage boundary.
+ */
+class ProtoChunkStatusMap
+{
+public:
+    void             Set(int32_t chunkX, int32_t chunkY, ProtoChunkStatus status);
+    ProtoChunkStatus Get(int32_t chunkX, int32_t chunkY) const;
+
+    /**
+     * @brief Number of chunks in the pipeline per status (indexed by ProtoChunkStatus)
+     */
+    void GetStatusCounts(size_t (&outCounts)[static_cast<size_t>(ProtoChunkStatus::Count)]) const;
+
+private:
+    static uint64_t PackKey(int32_t chunkX, int32_t chunkY);
+
+    mutable std::mutex                             m_mutex;
+    std::unordered_map<uint64_t, ProtoChunkStatus> m_statuses;
+};
@@ -0,0 +1,138 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @brief Thread-safe LRU cache split into independently locked shards
+ *
+ * Each key maps to one shard (by hash), so threads working on different keys rarely contend
+ * and every lock only covers a hash lookup plus a list splice. Values are immutable and
+ * handed out as shared_ptr<const Value>, so a caller keeps using an entry after it has been
+ * evicted.
+ *
+ * GetOrCreate() runs the factory outside the lock: two threads missing the same key at the
+ * same time may both compute it, the first insert wins and both get the same value back.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedLruCache
+{
+public:
+    using ValuePtr = std::shared_ptr<const Value>;
+
+    /**
+     * @param capacity Maximum number of entries (split evenly across shards, at least one each)
+     * @param shardCount Number of independently locked shards
+     */
+    explicit ShardedLruCache(size_t capacity, size_t shardCount = 16)
+        : m_shardCount(shardCount > 0 ? shardCount : 1)
+          , m_shards(std::make_unique<Shard[]>(m_shardCount))
+    {
+        size_t shardCapacity = capacity / m_shardCount;
+        for (size_t i = 0; i < m_shardCount; ++i)
+        {
+            m_shards[i].capacity = shardCapacity > 0 ? shardCapacity : 1;
+        }
+    }
+
+    ShardedLruCache(const ShardedLruCache&)            = delete;
+    ShardedLruCache& operator=(const ShardedLruCache&) = delete;
+
+    /**
+     * @brief Cached value for key (marked most recently used), or nullptr
+     */
+    ValuePtr Find(const Key& key)
+    {
+        Shard&                      shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto                        it = shard.index.find(key);
+        if (it == shard.index.end())
+        {
+            m_missCount.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        m_hitCount.fetch_add(1, std::memory_order_relaxed);
+        return it->second->second;
+    }
+
+    /**
+     * @brief Insert value unless key is already cached; evicts the shard's least recently used entry
+     * @return The cached value for key (the existing one if another thread inserted first)
+     */
+    ValuePtr Insert(const Key& key, ValuePtr value)
+    {
+        Shard&                      shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto                        it = shard.index.find(key);
+        if (it != shard.index.end())
+        {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            return it->second->second;
+        }
+
+        shard.lru.emplace_front(key, std::move(value));
+        shard.index.emplace(key, shard.lru.begin());
+        if (shard.lru.size() > shard.capacity)
+        {
+            shard.index.erase(shard.lru.back().first);
+            shard.lru.pop_back();
+        }
+        return shard.lru.front().second;
+    }
+
+    /**
+     * @brief Cached value for key, computing and inserting factory() on a miss
+     */
+    template <typename Factory>
+    ValuePtr GetOrCreate(const Key& key, Factory&& factory)
+    {
+        ValuePtr cached = Find(key);
+        if (cached)
+        {
+            return cached;
+        }
+        return Insert(key, factory());
+    }
+
+    void Clear()
+    {
+        for (size_t i = 0; i < m_shardCount; ++i)
+        {
+            std::lock_guard<std::mutex> lock(m_shards[i].mutex);
+            m_shards[i].index.clear();
+            m_shards[i].lru.clear();
+        }
+    }
+
+    uint64_t GetHitCount() const { return m_hitCount.load(std::memory_order_relaxed); }
+    uint64_t GetMissCount() const { return m_missCount.load(std::memory_order_relaxed); }
+
+private:
+    using Entry     = std::pair<Key, ValuePtr>;
+    using EntryList = std::list<Entry>;
+
+    struct Shard
+    {
+        std::mutex                                                  mutex;
+        EntryList                                                   lru; // Front = most recently used
+        std::unordered_map<Key, typename EntryList::iterator, Hash> index;
+        size_t                                                      capacity = 1;
+    };
+
+    Shard& GetShard(const Key& key)
+    {
+        // Shard on the high bits so the shard's own hash map still sees well spread low bits
+        uint64_t hash = static_cast<uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ull;
+        return m_shards[(hash >> 32) % m_shardCount];
+    }
+
+    size_t                   m_shardCount;
+    std::unique_ptr<Shard[]> m_shards;
+    std::atomic<uint64_t>    m_hitCount{0};
+    std::atomic<uint64_t>    m_missCount{0};
+};
@@ -1,5 +1,8 @@
 ﻿#include "SimpleMinerGenerator.hpp"
 #include "SimpleMinerTreeGenerator.hpp"
+#include "ChunkCoords.hpp"
+#include "ChunkGenerationToken.hpp"
+#include "FeatureRandom.hpp"
 #include "Engine/Registry/Block/BlockRegistry.hpp"
 #include "Engine/Core/Logger/LoggerAPI.hpp"
 #include "Engine/Core/StringUtils.hpp"
@@ -8,6 +11,9 @@
 #include "Engine/Math/SmoothNoise.hpp"
 #include <cmath>
 #include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <thread>
 
 #include "Engine/Math/IntVec3.hpp"
 #include "Engine/Voxel/Function/ConstantDensityFunction.hpp"
@@ -18,10 +24,110 @@ using namespace enigma::voxel;
 
 DEFINE_LOG_CATEGORY(LogWorldGenerator);
 
+namespace
+{
+    // Shared by the lattice and single-voxel noise cell paths so both produce identical floats
+    float TrilinearInterpolate(float c000, float c100, float c010, float c110,
+                               float c001, float c101, float c011, float c111,
+                               float fx, float fy, float fz)
+    {
+        float c00 = c000 + (c100 - c000) * fx;
+        float c10 = c010 + (c110 - c010) * fx;
+        float c01 = c001 + (c101 - c001) * fx;
+        float c11 = c011 + (c111 - c011) * fx;
+        float c0  = c00 + (c10 - c00) * fy;
+        float c1  = c01 + (c11 - c01) * fy;
+        return c0 + (c1 - c0) * fz;
+    }
+
+    uint64_t ElapsedMicros(std::chrono::steady_clock::time_point start)
+    {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
+
+    // Staging buffer layout matches the commit loop order: [z][y][x]
+    constexpr int STAGING_LAYER_SIZE = Chunk::CHUNK_SIZE_X * Chunk::CHUNK_SIZE_Y;
+    constexpr int STAGING_SIZE       = STAGING_LAYER_SIZE * Chunk::CHUNK_SIZE_Z;
+
+    static_assert(ClimateTile::SIZE == Chunk::CHUNK_SIZE_X && ClimateTile::SIZE == Chunk::CHUNK_SIZE_Y,
+                  "Climate tiles must match the chunk column layout");
+    static_assert(SurfaceHeightTile::SIZE == Chunk::CHUNK_SIZE_X && SurfaceHeightTile::SIZE == Chunk::CHUNK_SIZE_Y,
+                  "Surface height tiles must match the chunk column layout");
+
+    int StagingIndex(int x, int y, int z)
+    {
+        return (z * Chunk::CHUNK_SIZE_Y + y) * Chunk::CHUNK_SIZE_X + x;
+    }
+
+    // Long loops poll the cancellation token once per section of this many Z layers
+    constexpr int CANCEL_POLL_LAYERS = 16;
+
+    std::atomic<uint32_t> s_nextInstanceId{1};
+
+    // Ore veins of one ore type (Minecraft Java 1.17 style counts and depth ranges)
+    struct OreVeinRule
+    {
+        int veinsPerChunk;
+        int veinSize; // Blocks visited by the vein's random walk
+        int minZ;
+        int maxZ;
+    };
+
+    // Coal, iron, gold, diamond (same order as the staging IDs in PlaceOreVeins)
+    constexpr OreVeinRule ORE_VEIN_RULES[] = {
+        {20, 16, 0, 127},
+        {12, 9, 0, 63},
+        {2, 9, 0, 31},
+        {1, 7, 0, 15},
+    };
+
+    // Random streams per chunk: ORE_STREAM_BASE + rule * ORE_STREAMS_PER_RULE + vein
+    constexpr uint32_t ORE_STREAM_BASE      = 0x0E000000u;
+    constexpr uint32_t ORE_STREAMS_PER_RULE = 0x100u;
+
+    // Cave noise lattice: one sample every CAVE_CELL_XY blocks horizontally and CAVE_CELL_Z vertically
+    constexpr int CAVE_CELL_XY     = 4;
+    constexpr int CAVE_CELL_Z      = 8;
+    constexpr int CAVE_POINTS_XY   = Chunk::CHUNK_SIZE_X / CAVE_CELL_XY + 1;
+    constexpr int CAVE_POINTS_Z    = Chunk::CHUNK_SIZE_Z / CAVE_CELL_Z + 1;
+    constexpr int CAVE_NOISE_COUNT = 3; // Cheese, spaghetti A, spaghetti B
+
+    static_assert(Chunk::CHUNK_SIZE_X == Chunk::CHUNK_SIZE_Y && Chunk::CHUNK_SIZE_X % CAVE_CELL_XY == 0 && Chunk::CHUNK_SIZE_Z % CAVE_CELL_Z == 0,
+                  "Cave cells must tile the chunk");
+
+    constexpr int   CAVE_ROOF_THICKNESS = 5; // Solid blocks kept between a cave and the surface
+    constexpr int   CAVE_FLOOR_Z        = 1; // Bottom layer is never carved
+    constexpr int   LAVA_LEVEL          = 10; // Carved voxels at or below this Z become lava (lava lakes)
+    constexpr float CHEESE_THRESHOLD    = 0.45f; // Cheese noise above this is open cave
+    constexpr float SPAGHETTI_WIDTH     = 0.06f; // Both spaghetti noises within +-width is a tunnel
+
+    // Seed offsets of the cave noises (past the NoiseType climate seeds)
+    constexpr uint32_t CAVE_CHEESE_SEED      = 100;
+    constexpr uint32_t CAVE_SPAGHETTI_A_SEED = 101;
+    constexpr uint32_t CAVE_SPAGHETTI_B_SEED = 102;
+
+    int CaveLatticeIndex(int noise, int latticeX, int latticeY, int latticeZ)
+    {
+        return ((noise * CAVE_POINTS_XY + latticeY) * CAVE_POINTS_XY + latticeX) * CAVE_POINTS_Z + latticeZ;
+    }
+
+    float InterpolateCaveNoise(const float* lattice, int noise, int cellX, int cellY, int cellZ, float fx, float fy, float fz)
+    {
+        const float* v00 = lattice + CaveLatticeIndex(noise, cellX, cellY, cellZ);
+        const float* v10 = lattice + CaveLatticeIndex(noise, cellX + 1, cellY, cellZ);
+        const float* v01 = lattice + CaveLatticeIndex(noise, cellX, cellY + 1, cellZ);
+        const float* v11 = lattice + CaveLatticeIndex(noise, cellX + 1, cellY + 1, cellZ);
+        return TrilinearInterpolate(v00[0], v10[0], v01[0], v11[0], v00[1], v10[1], v01[1], v11[1], fx, fy, fz);
+    }
+}
+
 // ========== 构造函数实现 ==========
-SimpleMinerGenerator::SimpleMinerGenerator(uint32_t worldSeed)
+SimpleMinerGenerator::SimpleMinerGenerator(uint32_t worldSeed, const WorldGenConfig& config)
     : TerrainGenerator("simpleminer_generator", "simpleminer")
       , m_worldSeed(worldSeed)
+      , m_config(config)
+      , m_instanceId(s_nextInstanceId.fetch_add(1, std::memory_order_relaxed))
 {
     // Phase 2: 初始化高度偏移样条曲线 (Height Offset Spline)
     // 控制不同大陆度下的地形基准高度偏移
@@ -121,6 +227,11 @@ SimpleMinerGenerator::SimpleMinerGenerator(uint32_t worldSeed)
     m_peaksValleysSpline = std::make_shared<SplineDensityFunction>(
         std::make_unique<ConstantDensityFunction>(0.0f), std::move(peaksValleysPoints));
 
+    if (m_config.m_useSplineLut)
+    {
+        BakeSplineLuts();
+    }
+
     // 使用提供的 seed 初始化所有噪声生成器
     InitializeNoiseGenerators();
 
@@ -132,7 +243,33 @@ SimpleMinerGenerator::SimpleMinerGenerator(uint32_t worldSeed)
     // 结果：ApplySurfaceRules 中 GetBiomeAt() 返回 null，表面方块无法应用
     InitializeBiomes();
 
+    // Tree stamps resolve block IDs from the registry, so build them once here instead of per chunk
+    m_treeStampLibrary = std::make_unique<const TreeStampLibrary>();
+
+    // Surface height queries (trees, spawn, GetGroundHeightAt) without binary-searching density
+    m_heightmapService = std::make_unique<HeightmapService>(
+        static_cast<size_t>(m_config.m_heightmapGeneratedTiles), static_cast<size_t>(m_config.m_heightmapEstimatedTiles),
+        [this](int32_t tileX, int32_t tileY, int16_t* outHeights) { EstimateSurfaceTile(tileX, tileY, outHeights); },
+        [this](int globalX, int globalY) { return ComputeExactSurfaceHeight(globalX, globalY); });
+
+    if (m_config.m_useClimateCache)
+    {
+        m_climateCache = std::make_unique<ClimateTileCache>(static_cast<size_t>(m_config.m_climateCacheMaxTiles));
+        LogInfo(LogWorldGenerator, "Climate tile cache enabled: %d tiles", m_config.m_climateCacheMaxTiles);
+    }
+
     LogInfo(LogWorldGenerator, "SimpleMinerGenerator created with seed: %u", m_worldSeed);
+    if (m_config.m_useNoiseCells)
+    {
+        LogInfo(LogWorldGenerator, "Noise cell mode enabled: %dx%dx%d cells%s",
+                m_config.m_noiseCellSizeXY, m_config.m_noiseCellSizeXY, m_config.m_noiseCellSizeZ,
+                m_config.m_compareNoiseCells ? " (comparison mode)" : "");
+    }
+    if (m_config.m_treePlacement == "grid" || m_config.m_compareTreePlacement)
+    {
+        LogInfo(LogWorldGenerator, "Tree placement: %s (grid cell %d)%s", m_config.m_treePlacement.c_str(),
+                m_config.m_treeGridCellSize, m_config.m_compareTreePlacement ? " (comparison mode)" : "");
+    }
 }
 
 bool SimpleMinerGenerator::GenerateChunk(Chunk* chunk, int32_t chunkX, int32_t chunkY, uint32_t worldSeed)
@@ -154,275 +291,517 @@ bool SimpleMinerGenerator::GenerateChunk(Chunk* chunk, int32_t chunkX, int32_t c
         return false;
     }
 
+    // ===== Phase 3: 协作式取消 =====
+    // 只在阶段 / section 边界轮询（不再逐体素检查 chunk 状态）
+    ChunkGenerationToken cancelToken(chunk, m_cancelEpoch);
+
     // Use provided world seed or fallback to member seed
     uint32_t effectiveSeed = (worldSeed != 0) ? worldSeed : m_worldSeed;
 
-    // Establish world-space position and bounds of this chunk
-    IntVec3 chunkPosition(chunkX * Chunk::CHUNK_SIZE_X, chunkY * Chunk::CHUNK_SIZE_Y, 0);
+    // Per-worker buffers (column cache, noise lattice, block staging) are reused across chunks
+    ProtoChunk proto;
+    proto.chunk       = chunk;
+    proto.chunkX      = chunkX;
+    proto.chunkY      = chunkY;
+    proto.seed        = effectiveSeed;
+    proto.scratch     = &GetThreadScratch();
+    proto.cancelToken = &cancelToken;
 
-    // Allocate per-(x,y) maps
-    const int          mapSize = Chunk::CHUNK_SIZE_X * Chunk::CHUNK_SIZE_Y;
-    std::vector<int>   heightMapXY(mapSize);
-    std::vector<int>   dirtDepthXY(mapSize);
-    std::vector<float> humidityMapXY(mapSize);
-    std::vector<float> temperatureMapXY(mapSize);
+    if (!AdvanceProtoChunk(proto, ProtoChunkStatus::Full))
+    {
+        return false;
+    }
 
-    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    LogDebug(LogWorldGenerator, "Generated chunk (%d, %d) with SimpleMinerGenerator", chunkX, chunkY);
+    return true;
+}
+
+bool SimpleMinerGenerator::GenerateProtoChunk(int32_t chunkX, int32_t chunkY, ProtoChunkStatus target, int* outSurfaceHeight,
+                                              uint16_t* outSurfaceBlockIds)
+{
+    if (target > ProtoChunkStatus::Features)
+    {
+        // Only GenerateChunk commits
+        LogWarn(LogWorldGenerator, "GenerateProtoChunk - stage %s needs a chunk, stopping after features", GetProtoChunkStatusName(target));
+        target = ProtoChunkStatus::Features;
+    }
+
+    ChunkGenerationToken cancelToken(nullptr, m_cancelEpoch);
+    ProtoChunk           proto;
+    proto.chunkX      = chunkX;
+    proto.chunkY      = chunkY;
+    proto.seed        = m_worldSeed;
+    proto.scratch     = &GetThreadScratch();
+    proto.cancelToken = &cancelToken;
+
+    if (!AdvanceProtoChunk(proto, target))
+    {
+        return false;
+    }
+
+    const GenerationScratch& scratch = *proto.scratch;
+    for (int column = 0; column < STAGING_LAYER_SIZE; ++column)
     {
-        // ===== Phase 3: 外层循环状态验证（Z坐标） =====
-        // 频率：每次迭代（256次/chunk）
-        if (chunk->GetState() != ChunkState::Generating)
+        int surfaceZ = (proto.status >= ProtoChunkStatus::Shape) ? scratch.surfaceHeight[column] : -1;
+        if (outSurfaceHeight)
         {
-            LogDebug("SimpleMinerGenerator",
-                     "Chunk (%d, %d) state changed during Z iteration %d, abort generation",
-                     chunkX, chunkY, z);
-            return false;
+            outSurfaceHeight[column] = surfaceZ;
+        }
+        if (outSurfaceBlockIds)
+        {
+            outSurfaceBlockIds[column] = (surfaceZ >= 0) ? scratch.blockIds[surfaceZ * STAGING_LAYER_SIZE + column] : STAGING_NO_BLOCK;
         }
+    }
+    return true;
+}
 
-        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+uint64_t SimpleMinerGenerator::HashStagedBlocks(const std::vector<uint16_t>& blockIds)
+{
+    uint64_t hash = CONTENT_HASH_OFFSET;
+    for (uint16_t blockId : blockIds)
+    {
+        hash = (hash ^ blockId) * CONTENT_HASH_PRIME;
+    }
+    return hash;
+}
+
+bool SimpleMinerGenerator::GenerateDetachedChunkHash(int32_t chunkX, int32_t chunkY, uint64_t& outContentHash)
+{
+    if (!GenerateProtoChunk(chunkX, chunkY, ProtoChunkStatus::Features, nullptr, nullptr))
+    {
+        return false;
+    }
+
+    outContentHash = HashStagedBlocks(GetThreadScratch().blockIds);
+    return true;
+}
+
+bool SimpleMinerGenerator::GenerateRegionHashes(const std::vector<IntVec2>& chunks, int threadCount, std::vector<uint64_t>& outContentHashes)
+{
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<bool>   failed{false};
+    outContentHashes.assign(chunks.size(), 0);
+
+    // Same stages as GenerateChunk; which neighbours are already done depends on the scheduling
+    auto generateChunks = [&]()
+    {
+        std::vector<uint16_t> committed;
+        for (size_t index = nextChunk.fetch_add(1); index < chunks.size(); index = nextChunk.fetch_add(1))
         {
-            // ===== Phase 3: 中层循环状态验证（Y坐标） =====
-            // 频率：每10次迭代检查一次（性能优化）
-            if (y % 10 == 0 && chunk->GetState() != ChunkState::Generating)
+            ChunkGenerationToken cancelToken(nullptr, m_cancelEpoch);
+            ProtoChunk           proto;
+            proto.chunkX       = chunks[index].x;
+            proto.chunkY       = chunks[index].y;
+            proto.seed         = m_worldSeed;
+            proto.scratch      = &GetThreadScratch();
+            proto.cancelToken  = &cancelToken;
+            proto.commitBuffer = &committed;
+            if (!AdvanceProtoChunk(proto, ProtoChunkStatus::Full))
             {
-                LogDebug("SimpleMinerGenerator",
-                         "Chunk (%d, %d) state changed at Y=%d Z=%d, abort generation",
-                         chunkX, chunkY, y, z);
-                return false;
+                failed.store(true, std::memory_order_relaxed);
+                continue;
             }
 
-            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
-            {
-                int globalX = chunkX * Chunk::CHUNK_SIZE_X + x;
-                int globalY = chunkY * Chunk::CHUNK_SIZE_Y + y;
-                int globalZ = z;
-
-                // ========== Phase 2 & Phase 3 & Phase 4: 地形塑形流程 ==========
-                //
-                // 算法来源: Course Blog (Oct 17 - Continental; Oct 19 - Erosion; Oct 21 - Peaks/Valleys)
-                // 核心思想: 使用三层噪声协同控制地形形态
-                //
-                // 流程概述:
-                // 1. 采样大陆度噪声 (Continental) - 控制地形高度
-                // 2. 采样侵蚀度噪声 (Erosion) - 控制地形形态
-                // 3. 采样峰谷噪声 (PeaksValleys) - 控制峰谷细节
-                // 4. 通过样条曲线计算地形参数 (h, s, e, pv)
-                // 5. 计算3D密度场并添加垂直偏移(bias)
-                // 6. 应用高度偏移: density -= h
-                // 7. 计算动态基准高度和地形偏移: b, t
-                // 8. 应用挤压: density += s * t
-                // 9. 应用侵蚀: density += e * t
-                // 10. 应用峰谷: density += pv * abs(continentalness) * t
-                // 11. 放置方块: density < 0 → stone, density >= 0 → air
-
-                // 步骤1: 采样大陆度 (Continentalness) [-1, 1]
-                // 2D Perlin噪声，决定该位置是海洋(-1)还是大陆(+1)
-                float continentalness = SampleContinentalness(globalX, globalY);
-
-                // 步骤2: 采样侵蚀度 (Erosion) [-1, 1]
-                // 2D Perlin噪声，决定该位置是平坦(-1)还是崎岖(+1)
-                float erosion = SampleErosion(globalX, globalY);
-
-                // 步骤3: 采样峰谷度 (PeaksValleys) [-1, 1]
-                // 2D Perlin噪声，决定该位置是山峰(+1)还是山谷(-1)
-                float peaksValleys = SamplePeaksValleys(globalX, globalY);
-                UNUSED(peaksValleys)
-                // 步骤4: 通过样条曲线计算地形参数
-                // h (Height Offset): 高度偏移量，控制地形基准高度的上下浮动
-                //    海洋区域(c=-1): h=-0.6，降低基准高度，形成海底
-                //    大陆区域(c=+1): h=+0.6，抬升基准高度，形成陆地
-                float h = EvaluateHeightOffset(continentalness);
-
-                // s (Squashing): 挤压因子，控制地形的垂直拉伸/压缩
-                //    海洋区域(c=-1): s=0，不进行垂直变形
-                //    过渡区域(c=-0.25~0.25): s=2.0，增强垂直变化
-                //    大陆区域(c=+1): s=-1.5，压缩地形高度
-                float s = EvaluateSquashing(continentalness);
-
-                // e (Erosion Factor): 侵蚀因子，控制地形的粗糙度
-                //    平坦区域(e=-1): e=-0.3，减少垂直变化，形成平原
-                //    崎岖区域(e=+1): e=+0.6，增强垂直变化，形成峡谷
-                float e = EvaluateErosion(erosion);
-
-                // ========== 教授的 Density 计算公式 (1:1 复刻) ==========
-                // 来源: Course Blog (Oct 15 - Terrain Density and Bias; Oct 17 - Continents)
-                // 
-                // 核心设计理念:
-                //   1. 简洁性: 只使用 Continentalness 影响 terrain density
-                //   2. Erosion/PV: 仅用于 Biome 选择，不影响 density
-                //   3. 无 Height Gradient: 教授没有使用 Minecraft 1.18+ 的高度梯度机制
-                //   4. 无 Clamp: t 允许全范围影响，不限制范围
-                //
-                // 公式推导:
-                //   D(x, y, z) = N(x, y, z, s) + B(z)
-                //   B(z) = b × (z − t)
-                //   其中:
-                //     - N: 3D Perlin noise
-                //     - b: bias per block = 2 / CHUNK_SIZE_Z
-                //     - t: default terrain height = CHUNK_SIZE_Z / 2
-                //
-                // Continentalness 影响:
-                //   density -= h  (高度偏移)
-                //   density += s * t  (挤压因子)
-                //   其中 t = (z - b) / b，b 是动态基准高度
-
-                // 步骤 1: 基础 Density + Bias
-                float densityNoise = SampleNoise3D(globalX, globalY, globalZ);
-                float b_bias       = BIAS_PER_Z * (static_cast<float>(z) - TERRAIN_BASE_HEIGHT);
-                float density      = densityNoise + b_bias;
-
-                // 步骤 2: Continentalness Height Offset
-                // h ∈ [-0.6, 0.6]，通过样条曲线计算
-                // h > 0: 抬升地形(大陆)，h < 0: 降低地形(海洋)
-                density -= h;
-
-                // 步骤 3: Squashing Factor
-                // ⚠️ 修复说明 (2025-11-02)：
-                // 问题：当 h < 0（深海）时，b 可能变成负数，导致 t 计算错误
-                // 原因：b = 64 + (-1.0) × 128 = -64（负数！）
-                //       此时 t = (z - b) / b 会产生错误的符号和极端值
-                // 解决方案：确保 b > 0，防止除以零或负数
-                //
-                // 教授的公式：
-                // b = default_terrain_height + (h * (chunk_size_z / 2))
-                // t = (z - b) / b
-                // density -= s * t  （注意：教授用的是减法！）
-                //
-                // 但是，为了避免 b 变成负数，我们需要：
-                // 1. 使用绝对值确保 b > 0
-                // 2. 或者重新理解公式的含义
-
-                // 计算动态基准高度（考虑 continentalness 的影响）
-                float dynamic_base = TERRAIN_BASE_HEIGHT + (h * (static_cast<float>(Chunk::CHUNK_SIZE_Z) / 2.0f));
-
-                // 防止除以零或负数
-                if (dynamic_base <= 0.0f)
-                {
-                    dynamic_base = 1.0f; // 最小值为 1.0
-                }
+            // Committed blocks are final: nothing is applied to a chunk after its commit
+            outContentHashes[index] = HashStagedBlocks(committed);
+        }
+    };
 
-                // 计算归一化的垂直偏移
-                float t = (static_cast<float>(z) - dynamic_base) / dynamic_base;
-
-                // 应用 squashing factor
-                // s ∈ [-1.5, 2.0]，通过样条曲线计算
-                // s > 0: 拉伸地形(增强垂直变化)
-                // s < 0: 压缩地形(减弱垂直变化)
-                // 注意：教授的公式是 density -= s * t，但代码中使用 += 也能工作
-                // 因为样条曲线的符号已经调整过了
-                density += s * t;
-
-                // 步骤 4: Erosion Factor (Minecraft 1.18+ 官方实现)
-                // ⚠️ 新增功能 (2025-11-02): 应用 Erosion 因子到密度计算
-                // 原因：用户反馈平原和热带草原不够平坦
-                // 参考：Minecraft 1.18+ 地形生成系统
-                //
-                // Erosion 的作用：
-                // - e < 0 (低侵蚀): 减少垂直变化，形成平坦的平原
-                // - e > 0 (高侵蚀): 增强垂直变化，形成崎岖的山地和峡谷
-                //
-                // 公式：density += e * t
-                // 其中：
-                //   - e ∈ [-0.3, 0.6]（通过样条曲线从 Erosion 噪声映射）
-                //   - t: 归一化垂直偏移（已在上面计算）
-                //
-                // 效果：
-                //   - 平原 (e ≈ -0.3): density += (-0.3) * t，地形更平坦
-                //   - 山地 (e ≈ 0.6): density += 0.6 * t，地形更崎岖
-                density += e * t;
-
-                // 注意：PV (Peaks/Valleys) 在当前实现中只用于 Biome 选择
-                // 如果需要更精细的峰谷控制，可以添加：density += pv * |c| * t
-
-                // ===== Phase 3: 内层循环关键位置状态验证 =====
-                // 这是崩溃发生点，在访问 chunk 之前必须验证状态
-                // 频率：每次迭代（16 * 16 * 256 = 65536次/chunk）
-                if (chunk->GetState() != ChunkState::Generating)
-                {
-                    LogDebug("SimpleMinerGenerator",
-                             "Chunk (%d, %d) state changed at critical point X=%d Y=%d Z=%d, abort generation",
-                             chunkX, chunkY, x, y, z);
-                    return false; // 立即返回，不继续访问 chunk
-                }
+    std::vector<std::thread> workers;
+    for (int worker = 1; worker < threadCount; ++worker)
+    {
+        workers.emplace_back(generateChunks);
+    }
+    generateChunks();
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    return !failed.load();
+}
 
-                // Set block type based on density
-                if (density < 0.0f)
-                {
-                    auto stoneBlock = GetCachedBlockById(m_stoneId);
-                    if (stoneBlock)
-                    {
-                        auto* blockState = stoneBlock->GetDefaultState();
-                        if (blockState)
-                        {
-                            chunk->SetBlock(x, y, z, blockState);
-                        }
-                    }
-                }
-                else
-                {
-                    auto airBlock = GetCachedBlockById(m_airId);
-                    if (airBlock)
-                    {
-                        auto* blockState = airBlock->GetDefaultState();
-                        if (blockState)
-                        {
-                            chunk->SetBlock(x, y, z, blockState);
-                        }
-                    }
-                }
+void SimpleMinerGenerator::GetStageTotals(uint64_t (&outMicros)[PROTO_CHUNK_STAGE_COUNT], uint64_t (&outCounts)[PROTO_CHUNK_STAGE_COUNT]) const
+{
+    for (size_t index = 0; index < PROTO_CHUNK_STAGE_COUNT; ++index)
+    {
+        outMicros[index] = m_stageMicros[index].load(std::memory_order_relaxed);
+        outCounts[index] = m_stageChunkCount[index].load(std::memory_order_relaxed);
+    }
+}
+
+void SimpleMinerGenerator::GetFeatureStepTotals(uint64_t (&outMicros)[FEATURE_STEP_COUNT]) const
+{
+    for (size_t index = 0; index < FEATURE_STEP_COUNT; ++index)
+    {
+        outMicros[index] = m_featureStepMicros[index].load(std::memory_order_relaxed);
+    }
+}
+
+ProtoChunkStatus SimpleMinerGenerator::GetProtoChunkStatus(int32_t chunkX, int32_t chunkY) const
+{
+    return m_protoChunkStatus.Get(chunkX, chunkY);
+}
+
+bool SimpleMinerGenerator::AdvanceProtoChunk(ProtoChunk& proto, ProtoChunkStatus target)
+{
+    while (proto.status < target)
+    {
+        ProtoChunkStatus stage = static_cast<ProtoChunkStatus>(static_cast<uint8_t>(proto.status) + 1);
+
+        auto stageStart = std::chrono::steady_clock::now();
+        bool completed  = !proto.cancelToken->IsCancelled() && RunStage(proto, stage);
+
+        if (!completed)
+        {
+            m_cancelledChunkCount.fetch_add(1, std::memory_order_relaxed);
+            if (proto.chunk)
+            {
+                m_protoChunkStatus.Set(proto.chunkX, proto.chunkY, ProtoChunkStatus::Empty);
             }
+            return AbortGeneration(proto.chunkX, proto.chunkY, GetProtoChunkStatusName(stage));
+        }
+
+        // Only completed stages are timed, so the averages and the Full count cover finished work
+        uint64_t chunkCount = RecordStageTime(stage, ElapsedMicros(stageStart));
+
+        proto.status = stage;
+        if (proto.chunk)
+        {
+            m_protoChunkStatus.Set(proto.chunkX, proto.chunkY, stage);
+        }
+
+        if (stage == ProtoChunkStatus::Full && m_config.m_logStageTimings && chunkCount % 64 == 0)
+        {
+            LogStageTimings();
+        }
+    }
+    return true;
+}
+
+bool SimpleMinerGenerator::RunStage(ProtoChunk& proto, ProtoChunkStatus stage)
+{
+    switch (stage)
+    {
+    case ProtoChunkStatus::Climate: return RunClimateStage(proto);
+    case ProtoChunkStatus::Shape: return RunShapeStage(proto);
+    case ProtoChunkStatus::Surface: return RunSurfaceStage(proto);
+    case ProtoChunkStatus::Features: return RunFeatureStage(proto);
+    case ProtoChunkStatus::Full: return RunCommitStage(proto);
+    default:
+        LogError(LogWorldGenerator, "RunStage - invalid stage %d", static_cast<int>(stage));
+        return false;
+    }
+}
+
+bool SimpleMinerGenerator::RunClimateStage(ProtoChunk& proto)
+{
+    GenerationScratch& scratch   = *proto.scratch;
+    const int          chunkMinX = proto.chunkX * Chunk::CHUNK_SIZE_X;
+    const int          chunkMinY = proto.chunkY * Chunk::CHUNK_SIZE_Y;
+
+    // ========== Per-column climate cache ==========
+    // Continentalness and Erosion are 2D noises and the h/s/e splines only depend on them,
+    // so every value is identical for all Z levels of a column. Evaluate them once per (x, y) column
+    // (256 times per chunk instead of 65536) and let the 3D density loop read from the cache.
+    std::vector<ColumnShapeParams>& columnShape = scratch.columnShape;
+    columnShape.resize(STAGING_LAYER_SIZE);
+
+    // The chunk's climate tile covers exactly its columns (shared with neighbours' biome maps)
+    std::shared_ptr<const ClimateTile> climateTile = GetClimateTile(proto.chunkX, proto.chunkY);
+    for (int column = 0; column < STAGING_LAYER_SIZE; ++column)
+    {
+        columnShape[column] = BuildColumnShape(climateTile->continentalness[column], climateTile->erosion[column]);
+        ComputeNoiseBand(columnShape[column]);
+    }
+
+    // ========== Height band culling ==========
+    // Only voxels inside their column's band need the 8-octave 3D noise; high air and deep rock are
+    // decided by the column terms alone. Track the chunk-wide union of the bands for the noise lattice.
+    proto.bandUnionMinZ   = Chunk::CHUNK_SIZE_Z;
+    proto.bandUnionMaxZ   = -1;
+    proto.noiseVoxelCount = 0;
+    for (const ColumnShapeParams& column : columnShape)
+    {
+        if (column.bandMinZ <= column.bandMaxZ)
+        {
+            proto.bandUnionMinZ = (std::min)(proto.bandUnionMinZ, column.bandMinZ);
+            proto.bandUnionMaxZ = (std::max)(proto.bandUnionMaxZ, column.bandMaxZ);
+            proto.noiseVoxelCount += column.bandMaxZ - column.bandMinZ + 1;
+        }
+    }
+
+    // Phase 7-9 tree generator (fetched here because its placement bounds size the biome map)
+    // Each worker keeps its own instance (independent noise cache) across chunks
+    proto.treeGenerator = &AcquireTreeGenerator(scratch, proto.seed);
+
+    // ========== Per-chunk biome map ==========
+    // One biome per column for the chunk plus the tree placement border, shared by surface rules
+    // and tree generation so every column is classified exactly once
+    int treeMinX, treeMaxX, treeMinY, treeMaxY;
+    proto.treeGenerator->GetPlacementBounds(proto.chunkX, proto.chunkY, treeMinX, treeMaxX, treeMinY, treeMaxY);
+    BuildBiomeMap((std::min)(treeMinX, chunkMinX), (std::min)(treeMinY, chunkMinY),
+                  (std::max)(treeMaxX, chunkMinX + Chunk::CHUNK_SIZE_X - 1), (std::max)(treeMaxY, chunkMinY + Chunk::CHUNK_SIZE_Y - 1),
+                  scratch.biomeMap);
+    return true;
+}
+
+bool SimpleMinerGenerator::RunShapeStage(ProtoChunk& proto)
+{
+    GenerationScratch&                    scratch     = *proto.scratch;
+    const std::vector<ColumnShapeParams>& columnShape = scratch.columnShape;
+    const int32_t                         chunkX      = proto.chunkX;
+    const int32_t                         chunkY      = proto.chunkY;
+    const int                             chunkMinX   = chunkX * Chunk::CHUNK_SIZE_X;
+
+    // ========== Noise cell mode ==========
+    // Sample the 8-octave 3D noise only on the coarse lattice (e.g. 5x5x33 points for 4x4x8 cells
+    // instead of 16x16x256) and trilinearly interpolate it per voxel. Only the noise term is
+    // interpolated; the column terms (bias, h, s, e) are still applied exactly per voxel.
+    const bool    useNoiseCells = m_config.m_useNoiseCells;
+    NoiseLattice& noiseLattice  = scratch.noiseLattice;
+    if (useNoiseCells)
+    {
+        auto latticeStart = std::chrono::steady_clock::now();
+        // 对比模式需要完整的 lattice（逐体素与精确密度比较）
+        bool fullLattice = m_config.m_compareNoiseCells;
+        BuildNoiseLattice(chunkX, chunkY, fullLattice ? 0 : proto.bandUnionMinZ, fullLattice ? Chunk::CHUNK_SIZE_Z - 1 : proto.bandUnionMaxZ,
+                          noiseLattice);
+        if (m_config.m_compareNoiseCells)
+        {
+            CompareNoiseCells(chunkX, chunkY, columnShape, noiseLattice, ElapsedMicros(latticeStart));
         }
     }
 
-    // Fill water below sea level
-    auto waterBlock = GetCachedBlockById(m_waterId);
-    if (waterBlock)
+    // ========== Block staging ==========
+    // Terrain, water and surface rules write numeric block IDs into a dense per-worker buffer;
+    // the chunk is only touched once, by the commit stage.
+    std::vector<uint16_t>& blockIds = scratch.blockIds;
+    blockIds.resize(STAGING_SIZE);
+    const uint16_t stoneStagingId = ToStagingId(m_stoneId);
+    const uint16_t airStagingId   = ToStagingId(m_airId);
+    const uint16_t waterStagingId = ToStagingId(m_waterId);
+
+    // Single pass: stone / air / water are decided where density is computed, and the topmost
+    // solid Z of every column is recorded for surface rules and tree placement (-1 = no solid)
+    const uint16_t    seaStagingId  = (waterStagingId != STAGING_NO_BLOCK) ? waterStagingId : airStagingId;
+    std::vector<int>& surfaceHeight = scratch.surfaceHeight;
+    surfaceHeight.assign(STAGING_LAYER_SIZE, -1);
+
+    // Section by section: a section that no column's noise band reaches and whose column terms agree
+    // everywhere (deep rock, open sky, open sea) is filled in one go instead of per voxel
+    int uniformSectionCount = 0;
+    for (int sectionMinZ = 0; sectionMinZ < Chunk::CHUNK_SIZE_Z; sectionMinZ += SECTION_HEIGHT)
     {
-        auto* waterState = waterBlock->GetDefaultState();
-        if (waterState)
+        if (proto.cancelToken->IsCancelled())
+        {
+            return false;
+        }
+
+        const int      sectionMaxZ = sectionMinZ + SECTION_HEIGHT - 1;
+        const uint16_t sectionFill = ClassifySection(columnShape, sectionMinZ, sectionMaxZ, stoneStagingId, seaStagingId, airStagingId);
+        if (sectionFill != STAGING_NO_BLOCK)
         {
-            for (int z = 0; z < SEA_LEVEL; ++z)
+            std::fill(blockIds.begin() + sectionMinZ * STAGING_LAYER_SIZE, blockIds.begin() + (sectionMaxZ + 1) * STAGING_LAYER_SIZE, sectionFill);
+            if (sectionFill == stoneStagingId)
             {
-                // ===== Phase 3: 水填充循环状态验证 =====
-                if (chunk->GetState() != ChunkState::Generating)
-                {
-                    LogDebug("SimpleMinerGenerator",
-                             "Chunk (%d, %d) state changed during water fill at Z=%d, abort generation",
-                             chunkX, chunkY, z);
-                    return false;
-                }
+                std::fill(surfaceHeight.begin(), surfaceHeight.end(), sectionMaxZ);
+            }
+            ++uniformSectionCount;
+            continue;
+        }
+
+        for (int z = sectionMinZ; z <= sectionMaxZ; ++z)
+        {
+            // Non-solid voxels below sea level are water
+            const uint16_t emptyStagingId = (z < SEA_LEVEL) ? seaStagingId : airStagingId;
 
-                for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+            for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+            {
+                // Exact mode: sample the 3D density noise for the in-band X span of the row at once
+                // (SIMD when batch noise is enabled)
+                float densityRow[Chunk::CHUNK_SIZE_X];
+                if (!useNoiseCells)
                 {
+                    int rowMinX = Chunk::CHUNK_SIZE_X;
+                    int rowMaxX = -1;
                     for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
                     {
-                        auto* currentBlock = chunk->GetBlock(x, y, z);
-                        if (currentBlock && currentBlock->GetBlock()->GetNumericId() == m_airId)
+                        const ColumnShapeParams& column = columnShape[y * Chunk::CHUNK_SIZE_X + x];
+                        if (z >= column.bandMinZ && z <= column.bandMaxZ)
                         {
-                            chunk->SetBlock(x, y, z, waterState);
+                            rowMinX = (std::min)(rowMinX, x);
+                            rowMaxX = x;
                         }
                     }
+                    if (rowMinX <= rowMaxX)
+                    {
+                        SampleNoise3DRow(chunkMinX + rowMinX, 1, chunkY * Chunk::CHUNK_SIZE_Y + y, z, rowMaxX - rowMinX + 1, densityRow + rowMinX);
+                    }
+                }
+
+                for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+                {
+                    int globalX = chunkMinX + x;
+                    int globalY = chunkY * Chunk::CHUNK_SIZE_Y + y;
+                    int globalZ = z;
+
+                    // ========== Phase 2 & Phase 3 & Phase 4: 地形塑形流程 ==========
+                    //
+                    // 算法来源: Course Blog (Oct 17 - Continental; Oct 19 - Erosion; Oct 21 - Peaks/Valleys)
+                    // 核心思想: 使用三层噪声协同控制地形形态
+                    //
+                    // 1-4. 2D 气候噪声 (C, E) 与样条 (h, s, e) 已在上方的列缓存中按 (x, y) 计算
+                    // 5.   计算3D密度场并添加垂直偏移(bias)
+                    // 6-9. ApplyColumnShaping(): density -= h; density += s * t; density += e * t
+                    // 10.  放置方块: density < 0 → stone, density >= 0 → air
+                    const ColumnShapeParams& column = columnShape[y * Chunk::CHUNK_SIZE_X + x];
+
+                    // 高度带之外的体素：噪声不影响 solid/air 结果，使用 0 即可得到完全相同的方块
+                    float densityNoise = 0.0f;
+                    if (globalZ >= column.bandMinZ && globalZ <= column.bandMaxZ)
+                    {
+                        densityNoise = useNoiseCells
+                                           ? SampleNoiseLattice(noiseLattice, globalX, globalY, globalZ)
+                                           : densityRow[x];
+                    }
+                    float density = ApplyColumnShaping(column, densityNoise, globalZ);
+
+                    // Set block type based on density (staging only, no chunk access)
+                    if (density < 0.0f)
+                    {
+                        blockIds[StagingIndex(x, y, z)]            = stoneStagingId;
+                        surfaceHeight[y * Chunk::CHUNK_SIZE_X + x] = z; // Z ascends, so the last write is the top
+                    }
+                    else
+                    {
+                        blockIds[StagingIndex(x, y, z)] = emptyStagingId;
+                    }
                 }
             }
         }
     }
 
+    LogDebug(LogWorldGenerator, "Chunk (%d, %d): 3D density noise evaluated for %d / %d voxels (band Z %d-%d), %d / %d sections uniform",
+             chunkX, chunkY, proto.noiseVoxelCount, STAGING_SIZE, proto.bandUnionMinZ, proto.bandUnionMaxZ, uniformSectionCount,
+             Chunk::CHUNK_SIZE_Z / SECTION_HEIGHT);
+    return true;
+}
+
+bool SimpleMinerGenerator::RunSurfaceStage(ProtoChunk& proto)
+{
     // Apply biome surface rules (grass, sand, snow, etc.)
-    ApplySurfaceRules(chunk, chunkX, chunkY);
+    GenerationScratch& scratch = *proto.scratch;
+    ApplySurfaceRulesToStaging(scratch.blockIds.data(), scratch.surfaceHeight.data(), scratch.biomeMap, proto.chunkX, proto.chunkY);
+    return true;
+}
+
+bool SimpleMinerGenerator::RunFeatureStage(ProtoChunk& proto)
+{
+    GenerationScratch&        scratch       = *proto.scratch;
+    SimpleMinerTreeGenerator& treeGenerator = *proto.treeGenerator;
+
+    // Phase 7-9: Generate trees (into staging, committed together with the terrain)
+    auto stepStart = std::chrono::steady_clock::now();
+    treeGenerator.SetSurfaceHeightmap(scratch.surfaceHeight.data());
+    treeGenerator.SetBiomeMap(&scratch.biomeMap);
+    treeGenerator.GenerateTreesInStaging(scratch.blockIds.data(), proto.chunkX, proto.chunkY);
+    m_featureStepMicros[static_cast<size_t>(FeatureStep::Trees)].fetch_add(ElapsedMicros(stepStart), std::memory_order_relaxed);
+    if (m_config.m_compareTreePlacement)
+    {
+        CompareTreePlacement(treeGenerator, proto.chunkX, proto.chunkY);
+    }
 
-    // Phase 7-9: Generate trees
-    // Create thread-local TreeGenerator instance to avoid race conditions
-    // Each thread gets its own instance with independent noise cache
-    auto treeGenerator = std::make_unique<SimpleMinerTreeGenerator>(effectiveSeed, this, this);
-    treeGenerator->GenerateTrees(chunk, chunkX, chunkY);
+    // Caves before ores: veins crossing a cave stay exposed on its walls
+    if (m_config.m_useCaves)
+    {
+        stepStart = std::chrono::steady_clock::now();
+        CarveCaves(scratch.blockIds.data(), scratch.surfaceHeight.data(), proto.chunkX, proto.chunkY, scratch.caveLattice);
+        m_featureStepMicros[static_cast<size_t>(FeatureStep::Caves)].fetch_add(ElapsedMicros(stepStart), std::memory_order_relaxed);
+    }
 
-    // Mark chunk as generated and dirty for mesh building
-    chunk->SetGenerated(true);
-    chunk->MarkDirty();
-    LogDebug(LogWorldGenerator, "Generated chunk (%d, %d) with SimpleMinerGenerator", chunkX, chunkY);
+    // Ore veins replace stone only, so they go in before anything is built on top of the terrain
+    if (m_config.m_useOreVeins)
+    {
+        stepStart = std::chrono::steady_clock::now();
+        PlaceOreVeins(scratch.blockIds.data(), proto.chunkX, proto.chunkY, proto.seed);
+        m_featureStepMicros[static_cast<size_t>(FeatureStep::OreVeins)].fetch_add(ElapsedMicros(stepStart), std::memory_order_relaxed);
+    }
+    return true;
+}
+
+bool SimpleMinerGenerator::RunCommitStage(ProtoChunk& proto)
+{
+    GenerationScratch& scratch = *proto.scratch;
+
+    // Write the staged blocks into the chunk in one pass (verification runs keep a copy instead)
+    if (proto.commitBuffer)
+    {
+        proto.commitBuffer->assign(scratch.blockIds.begin(), scratch.blockIds.end());
+    }
+    else if (!CommitStagingToChunk(proto.chunk, scratch.blockIds.data(), proto.cancelToken))
+    {
+        return false;
+    }
+
+    // Publish the exact heights for neighbours' tree placement and ground queries
+    m_heightmapService->StoreGenerated(proto.chunkX, proto.chunkY, scratch.surfaceHeight.data());
+
+    if (proto.cancelToken->IsCancelled())
+    {
+        return false;
+    }
+
+    // Mark chunk as generated and dirty for mesh building (the engine lights and meshes it from here)
+    if (proto.chunk)
+    {
+        proto.chunk->SetGenerated(true);
+        proto.chunk->MarkDirty();
+    }
     return true;
 }
 
+uint64_t SimpleMinerGenerator::RecordStageTime(ProtoChunkStatus stage, uint64_t micros)
+{
+    size_t index = ToStageIndex(stage);
+    m_stageMicros[index].fetch_add(micros, std::memory_order_relaxed);
+    return m_stageChunkCount[index].fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void SimpleMinerGenerator::LogStageTimings() const
+{
+    // Average cost per chunk that completed the stage
+    double averageMs[PROTO_CHUNK_STAGE_COUNT];
+    for (size_t index = 0; index < PROTO_CHUNK_STAGE_COUNT; ++index)
+    {
+        uint64_t count   = m_stageChunkCount[index].load(std::memory_order_relaxed);
+        averageMs[index] = count ? m_stageMicros[index].load(std::memory_order_relaxed) / 1000.0 / static_cast<double>(count) : 0.0;
+    }
+
+    // Features split (the tree placement comparison, if enabled, is the remainder)
+    uint64_t featureCount = m_stageChunkCount[ToStageIndex(ProtoChunkStatus::Features)].load(std::memory_order_relaxed);
+    double   featureStepMs[FEATURE_STEP_COUNT];
+    for (size_t index = 0; index < FEATURE_STEP_COUNT; ++index)
+    {
+        featureStepMs[index] = featureCount ? m_featureStepMicros[index].load(std::memory_order_relaxed) / 1000.0 / static_cast<double>(featureCount) : 0.0;
+    }
+
+    size_t inFlight[static_cast<size_t>(ProtoChunkStatus::Count)];
+    m_protoChunkStatus.GetStatusCounts(inFlight);
+
+    LogInfo(LogWorldGenerator,
+            "Pipeline over %llu chunks: climate %.3f ms, shape %.3f ms, surface %.3f ms, "
+            "features %.3f ms (trees %.3f, caves %.3f, ores %.3f), commit %.3f ms "
+            "(in flight: %zu climate, %zu shape, %zu surface, %zu features; %llu cancelled)",
+            static_cast<unsigned long long>(m_stageChunkCount[ToStageIndex(ProtoChunkStatus::Full)].load(std::memory_order_relaxed)),
+            averageMs[ToStageIndex(ProtoChunkStatus::Climate)], averageMs[ToStageIndex(ProtoChunkStatus::Shape)],
+            averageMs[ToStageIndex(ProtoChunkStatus::Surface)], averageMs[ToStageIndex(ProtoChunkStatus::Features)],
+            featureStepMs[static_cast<size_t>(FeatureStep::Trees)], featureStepMs[static_cast<size_t>(FeatureStep::Caves)],
+            featureStepMs[static_cast<size_t>(FeatureStep::OreVeins)], averageMs[ToStageIndex(ProtoChunkStatus::Full)],
+            inFlight[static_cast<size_t>(ProtoChunkStatus::Climate)], inFlight[static_cast<size_t>(ProtoChunkStatus::Shape)],
+            inFlight[static_cast<size_t>(ProtoChunkStatus::Surface)], inFlight[static_cast<size_t>(ProtoChunkStatus::Features)],
+            static_cast<unsigned long long>(m_cancelledChunkCount.load(std::memory_order_relaxed)));
+}
+
 std::shared_ptr<enigma::registry::block::Block> SimpleMinerGenerator::GetCachedBlock(const std::string& blockName) const
 {
     // Check ID cache first (thread-safe read)
@@ -547,6 +926,25 @@ void SimpleMinerGenerator::InitializeBlockCache()
     m_acaciaLogId        = BlockRegistry::GetBlockId("simpleminer", "acacia_log");
     m_acaciaLeavesId     = BlockRegistry::GetBlockId("simpleminer", "acacia_leaves");
 
+    // ========== Phase 4: 默认 BlockState 平铺表（staging 提交使用） ==========
+    for (const auto& [blockId, block] : m_blockByIdCache)
+    {
+        if (!block)
+        {
+            continue;
+        }
+        if (blockId >= STAGING_NO_BLOCK)
+        {
+            LogWarn(LogWorldGenerator, "Block id %d cannot be staged (max %d)", blockId, STAGING_NO_BLOCK - 1);
+            continue;
+        }
+        if (blockId >= static_cast<int>(m_defaultStateById.size()))
+        {
+            m_defaultStateById.resize(blockId + 1, nullptr);
+        }
+        m_defaultStateById[blockId] = block->GetDefaultState();
+    }
+
     // ========== 日志输出缓存统计 ==========
     LogInfo(LogWorldGenerator,
             "Block cache initialized: %zu blocks cached, %d critical blocks verified (%d missing)",
@@ -582,7 +980,7 @@ void SimpleMinerGenerator::InitializeBiomes()
     // ========== Step 2: Create 15 Biome instances ==========
 
     // 1. Ocean (-1.0 to -0.455 C, all T/H)
-    m_oceanBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::Ocean)] = std::make_shared<Biome>(
         "ocean",
         Biome::ClimateSettings(0.0f, 0.0f, -0.7f, 0.0f, 0.0f), // T, H, C, E, W
         Biome::SurfaceRules(m_sandId, m_dirtId, m_dirtId, 4)
@@ -592,7 +990,7 @@ void SimpleMinerGenerator::InitializeBiomes()
     );
 
     // 2. Deep Ocean (-1.2 to -1.05 C)
-    m_deepOceanBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::DeepOcean)] = std::make_shared<Biome>(
         "deep_ocean",
         Biome::ClimateSettings(0.0f, 0.0f, -1.1f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_gravelId, m_gravelId, m_gravelId, 0) // Wiki: Gravel bottom, no filler
@@ -602,7 +1000,7 @@ void SimpleMinerGenerator::InitializeBiomes()
     );
 
     // 3. Frozen Ocean (T < -0.45)
-    m_frozenOceanBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::FrozenOcean)] = std::make_shared<Biome>(
         "frozen_ocean",
         Biome::ClimateSettings(-0.7f, 0.0f, -0.7f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_packedIceId, m_gravelId, m_gravelId, 0) // Wiki: Packed Ice surface
@@ -611,116 +1009,172 @@ void SimpleMinerGenerator::InitializeBiomes()
     );
 
     // 4. Beach (Coast region)
-    m_beachBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::Beach)] = std::make_shared<Biome>(
         "beach",
         Biome::ClimateSettings(0.0f, 0.0f, -0.15f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_sandId, m_dirtId, m_sandId, 4)
     );
 
     // 5. Snowy Beach (T < -0.45)
-    m_snowyBeachBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::SnowyBeach)] = std::make_shared<Biome>(
         "snowy_beach",
         Biome::ClimateSettings(-0.7f, 0.0f, -0.15f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_snowBlockId, m_sandId, m_gravelId, 3) // Wiki: Snow Block on top
     );
 
     // 6. Desert (T4 = 0.55-1.0, H0-H2 = -1.0-0.1)
-    m_desertBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::Desert)] = std::make_shared<Biome>(
         "desert",
         Biome::ClimateSettings(0.8f, -0.3f, 0.3f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_sandId, m_sandstoneId, m_sandId, 4)
     );
 
     // 7. Savanna (T3-T4, H0-H1)
-    m_savannaBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::Savanna)] = std::make_shared<Biome>(
         "savanna",
         Biome::ClimateSettings(0.4f, -0.25f, 0.3f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_grassSavannaId, m_dirtId, m_gravelId, 4)
     );
 
     // 8. Plains (default temperate biome)
-    m_plainsBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::Plains)] = std::make_shared<Biome>(
         "plains",
         Biome::ClimateSettings(0.0f, 0.0f, 0.3f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_grassId, m_dirtId, m_gravelId, 4)
     );
 
     // 9. Snowy Plains (T0 = -1.0 to -0.45)
-    m_snowyPlainsBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::SnowyPlains)] = std::make_shared<Biome>(
         "snowy_plains",
         Biome::ClimateSettings(-0.7f, 0.0f, 0.3f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_snowBlockId, m_dirtId, m_gravelId, 4) // Wiki: Snow Block on top
     );
 
     // 10. Forest (T1-T2, H2-H3)
-    m_forestBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::Forest)] = std::make_shared<Biome>(
         "forest",
         Biome::ClimateSettings(-0.1f, 0.2f, 0.3f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_grassId, m_dirtId, m_clayId, 4)
     );
 
     // 11. Jungle (T2-T3, H3-H4)
-    m_jungleBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::Jungle)] = std::make_shared<Biome>(
         "jungle",
         Biome::ClimateSettings(0.1f, 0.5f, 0.3f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_grassJungleId, m_dirtId, m_clayId, 4)
     );
 
     // 12. Taiga (T0-T1, H2-H4)
-    m_taigaBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::Taiga)] = std::make_shared<Biome>(
         "taiga",
         Biome::ClimateSettings(-0.3f, 0.3f, 0.3f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_grassTaigaId, m_dirtId, m_gravelId, 4)
     );
 
     // 13. Snowy Taiga (T0, H2-H3)
-    m_snowyTaigaBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::SnowyTaiga)] = std::make_shared<Biome>(
         "snowy_taiga",
         Biome::ClimateSettings(-0.7f, 0.2f, 0.3f, 0.0f, 0.0f),
         Biome::SurfaceRules(m_snowBlockId, m_dirtId, m_gravelId, 4) // Wiki: Snow Block on top
     );
 
     // 14. Stony Peaks (PV=Peaks, E=0, T>0.2)
-    m_stonyPeaksBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::StonyPeaks)] = std::make_shared<Biome>(
         "stony_peaks",
         Biome::ClimateSettings(0.4f, 0.0f, 0.3f, -0.78f, 0.85f), // E0, PV=Peaks
         Biome::SurfaceRules(m_stoneId, m_stoneId, m_stoneId, 0)
     );
 
     // 15. Snowy Peaks (PV=Peaks, E=0, T<=0.2)
-    m_snowyPeaksBiome = std::make_shared<Biome>(
+    m_biomes[ToIndex(BiomeId::SnowyPeaks)] = std::make_shared<Biome>(
         "snowy_peaks",
         Biome::ClimateSettings(-0.3f, 0.0f, 0.3f, -0.78f, 0.85f),
         Biome::SurfaceRules(m_snowBlockId, m_stoneId, m_stoneId, 0) // Wiki: Stone filler below snow
     );
 
-    LogInfo(LogWorldGenerator, "Initialized 15 biomes with climate parameters and surface rules");
-}
+    BuildBiomeTable();
 
-// ========== Biome Lookup Table - Climate Classification Functions ==========
+    LogInfo(LogWorldGenerator, "Initialized %zu biomes with climate parameters and surface rules (%zu-entry climate table)",
+            BIOME_COUNT, BIOME_TABLE_SIZE);
+}
 
-/**
- * @brief Continentalness分类 - 第1层查找表
- *
- * ⚠️ 修复v3：恢复教授原始阈值以平衡海陆比例（2025-11-02）
- * 问题诊断：v2阈值导致海洋占比>80%，陆地过少
- * v3调整策略：恢复教授的原始阈值
- * - Deep Ocean: C < -0.455 (恢复原始值)
- * - Ocean: -0.455 <= C < -0.19 (恢复原始值)
- * - Coast: -0.19 <= C < -0.11 (恢复原始值)
- * - Near-inland: -0.11 <= C < 0.03 (恢复原始值)
+void SimpleMinerGenerator::BuildBiomeTable()
+{
+    for (size_t c = 0; c < CONTINENTALNESS_CATEGORY_COUNT; ++c)
+    {
+        for (size_t t = 0; t < TEMPERATURE_CATEGORY_COUNT; ++t)
+        {
+            for (size_t h = 0; h < HUMIDITY_CATEGORY_COUNT; ++h)
+            {
+                for (size_t pv = 0; pv < PEAKS_VALLEYS_CATEGORY_COUNT; ++pv)
+                {
+                    for (size_t e = 0; e < EROSION_CATEGORY_COUNT; ++e)
+                    {
+                        auto cCat  = static_cast<ContinentalnessCategory>(c);
+                        auto tCat  = static_cast<TemperatureCategory>(t);
+                        auto hCat  = static_cast<HumidityCategory>(h);
+                        auto pvCat = static_cast<PeaksValleysCategory>(pv);
+                        auto eCat  = static_cast<ErosionCategory>(e);
+                        m_biomeTable[BiomeTableIndex(cCat, tCat, hCat, pvCat, eCat)] = ClassifyBiome(cCat, tCat, hCat, pvCat, eCat);
+                    }
+                }
+            }
+        }
+    }
+}
+
+size_t SimpleMinerGenerator::BiomeTableIndex(ContinentalnessCategory cCat, TemperatureCategory tCat, HumidityCategory hCat,
+                                             PeaksValleysCategory    pvCat, ErosionCategory    eCat)
+{
+    size_t index = static_cast<size_t>(cCat);
+    index        = index * TEMPERATURE_CATEGORY_COUNT + static_cast<size_t>(tCat);
+    index        = index * HUMIDITY_CATEGORY_COUNT + static_cast<size_t>(hCat);
+    index        = index * PEAKS_VALLEYS_CATEGORY_COUNT + static_cast<size_t>(pvCat);
+    index        = index * EROSION_CATEGORY_COUNT + static_cast<size_t>(eCat);
+    return index;
+}
+
+// ========== Biome Lookup Table - Climate Classification Functions ==========
+
+namespace
+{
+    // Category upper bounds (exclusive): a value below THRESHOLDS[i] (and not below any earlier one) is category i,
+    // a value not below any of them is the last category
+    constexpr float CONTINENTALNESS_THRESHOLDS[] = {-0.455f, -0.19f, -0.11f, 0.03f, 0.30f}; // v3: 恢复教授原始值
+    constexpr float TEMPERATURE_THRESHOLDS[]     = {-0.45f, -0.15f, 0.20f, 0.55f};
+    constexpr float HUMIDITY_THRESHOLDS[]        = {-0.35f, -0.10f, 0.10f, 0.30f};
+    constexpr float PEAKS_VALLEYS_THRESHOLDS[]   = {-0.85f, -0.2f, 0.2f, 0.85f}; // PEAKS now >= 0.85 (was >= 0.7)
+    constexpr float EROSION_THRESHOLDS[]         = {-0.78f, -0.375f, -0.2225f, 0.05f, 0.45f, 0.55f};
+
+    template <size_t N>
+    int ClassifyByThresholds(float value, const float (&thresholds)[N])
+    {
+        int category = 0;
+        while (category < static_cast<int>(N) && !(value < thresholds[category]))
+        {
+            ++category;
+        }
+        return category;
+    }
+}
+
+/**
+ * @brief Continentalness分类 - 第1层查找表
+ *
+ * ⚠️ 修复v3：恢复教授原始阈值以平衡海陆比例（2025-11-02）
+ * 问题诊断：v2阈值导致海洋占比>80%，陆地过少
+ * v3调整策略：恢复教授的原始阈值
+ * - Deep Ocean: C < -0.455 (恢复原始值)
+ * - Ocean: -0.455 <= C < -0.19 (恢复原始值)
+ * - Coast: -0.19 <= C < -0.11 (恢复原始值)
+ * - Near-inland: -0.11 <= C < 0.03 (恢复原始值)
  * - Mid-inland: 0.03 <= C < 0.30 (恢复原始值)
  * - Far-inland: C >= 0.30 (恢复原始值)
  * 预期效果：配合Height Offset Spline v3参数，实现50:50海陆比例
  */
 SimpleMinerGenerator::ContinentalnessCategory SimpleMinerGenerator::ClassifyContinentalness(float c) const
 {
-    if (c < -0.455f) return ContinentalnessCategory::DEEP_OCEAN; // v3: 恢复教授原始值
-    if (c < -0.19f) return ContinentalnessCategory::OCEAN; // v3: 恢复教授原始值
-    if (c < -0.11f) return ContinentalnessCategory::COAST; // v3: 恢复教授原始值
-    if (c < 0.03f) return ContinentalnessCategory::NEAR_INLAND; // v3: 恢复教授原始值
-    if (c < 0.30f) return ContinentalnessCategory::MID_INLAND; // v3: 恢复教授原始值
-    return ContinentalnessCategory::FAR_INLAND;
+    return static_cast<ContinentalnessCategory>(ClassifyByThresholds(c, CONTINENTALNESS_THRESHOLDS));
 }
 
 /**
@@ -735,11 +1189,7 @@ SimpleMinerGenerator::ContinentalnessCategory SimpleMinerGenerator::ClassifyCont
  */
 SimpleMinerGenerator::TemperatureCategory SimpleMinerGenerator::ClassifyTemperature(float t) const
 {
-    if (t < -0.45f) return TemperatureCategory::T0;
-    if (t < -0.15f) return TemperatureCategory::T1;
-    if (t < 0.20f) return TemperatureCategory::T2;
-    if (t < 0.55f) return TemperatureCategory::T3;
-    return TemperatureCategory::T4;
+    return static_cast<TemperatureCategory>(ClassifyByThresholds(t, TEMPERATURE_THRESHOLDS));
 }
 
 /**
@@ -754,11 +1204,7 @@ SimpleMinerGenerator::TemperatureCategory SimpleMinerGenerator::ClassifyTemperat
  */
 SimpleMinerGenerator::HumidityCategory SimpleMinerGenerator::ClassifyHumidity(float h) const
 {
-    if (h < -0.35f) return HumidityCategory::H0;
-    if (h < -0.10f) return HumidityCategory::H1;
-    if (h < 0.10f) return HumidityCategory::H2;
-    if (h < 0.30f) return HumidityCategory::H3;
-    return HumidityCategory::H4;
+    return static_cast<HumidityCategory>(ClassifyByThresholds(h, HUMIDITY_THRESHOLDS));
 }
 
 /**
@@ -773,11 +1219,7 @@ SimpleMinerGenerator::HumidityCategory SimpleMinerGenerator::ClassifyHumidity(fl
  */
 SimpleMinerGenerator::PeaksValleysCategory SimpleMinerGenerator::ClassifyPeaksValleys(float pv) const
 {
-    if (pv < -0.85f) return PeaksValleysCategory::VALLEYS;
-    if (pv < -0.2f) return PeaksValleysCategory::LOW;
-    if (pv < 0.2f) return PeaksValleysCategory::MID;
-    if (pv < 0.85f) return PeaksValleysCategory::HIGH; // Changed from 0.7 to 0.85 to reduce Peaks triggering
-    return PeaksValleysCategory::PEAKS; // Now >= 0.85 (was >= 0.7)
+    return static_cast<PeaksValleysCategory>(ClassifyByThresholds(pv, PEAKS_VALLEYS_THRESHOLDS));
 }
 
 /**
@@ -794,13 +1236,7 @@ SimpleMinerGenerator::PeaksValleysCategory SimpleMinerGenerator::ClassifyPeaksVa
  */
 SimpleMinerGenerator::ErosionCategory SimpleMinerGenerator::ClassifyErosion(float e) const
 {
-    if (e < -0.78f) return ErosionCategory::E0;
-    if (e < -0.375f) return ErosionCategory::E1;
-    if (e < -0.2225f) return ErosionCategory::E2;
-    if (e < 0.05f) return ErosionCategory::E3;
-    if (e < 0.45f) return ErosionCategory::E4;
-    if (e < 0.55f) return ErosionCategory::E5;
-    return ErosionCategory::E6;
+    return static_cast<ErosionCategory>(ClassifyByThresholds(e, EROSION_THRESHOLDS));
 }
 
 /**
@@ -835,9 +1271,9 @@ SimpleMinerGenerator::ErosionCategory SimpleMinerGenerator::ClassifyErosion(floa
  * 
  * @param globalX 世界空间X坐标
  * @param globalY 世界空间Y坐标 (注意：这里是2D平面，Y实际是Z)
- * @return 该位置对应的Biome实例
+ * @return 该位置对应的 BiomeId（实例见 GetBiome）
  */
-std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY) const
+BiomeId SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY) const
 {
     // Sample 5D climate parameters
     float T  = SampleNoise2D(globalX, globalY, NoiseType::Temperature);
@@ -846,13 +1282,83 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
     float E  = SampleNoise2D(globalX, globalY, NoiseType::Erosion);
     float PV = SampleNoise2D(globalX, globalY, NoiseType::PeaksValleys);
 
-    // Classify parameters
-    auto cCat  = ClassifyContinentalness(C);
-    auto tCat  = ClassifyTemperature(T);
-    auto hCat  = ClassifyHumidity(H);
-    auto pvCat = ClassifyPeaksValleys(PV);
-    auto eCat  = ClassifyErosion(E);
+    return SelectBiome(T, H, C, E, PV);
+}
+
+void SimpleMinerGenerator::BuildBiomeMap(int minX, int minY, int maxX, int maxY, BiomeMap& outMap) const
+{
+    outMap.Reset(minX, minY, maxX, maxY);
+
+    // Walk the climate tiles overlapping the rectangle; border tiles usually come from the shared
+    // cache because the neighbouring chunk (or its own biome map) already computed them
+    const int tileMinX = FloorDivide(minX, ClimateTile::SIZE);
+    const int tileMaxX = FloorDivide(maxX, ClimateTile::SIZE);
+    const int tileMinY = FloorDivide(minY, ClimateTile::SIZE);
+    const int tileMaxY = FloorDivide(maxY, ClimateTile::SIZE);
+    for (int tileY = tileMinY; tileY <= tileMaxY; ++tileY)
+    {
+        for (int tileX = tileMinX; tileX <= tileMaxX; ++tileX)
+        {
+            std::shared_ptr<const ClimateTile> tile = GetClimateTile(tileX, tileY);
+
+            const int originX = tileX * ClimateTile::SIZE;
+            const int originY = tileY * ClimateTile::SIZE;
+            const int fromX   = (std::max)(minX, originX);
+            const int toX     = (std::min)(maxX, originX + ClimateTile::SIZE - 1);
+            const int fromY   = (std::max)(minY, originY);
+            const int toY     = (std::min)(maxY, originY + ClimateTile::SIZE - 1);
+            for (int globalY = fromY; globalY <= toY; ++globalY)
+            {
+                for (int globalX = fromX; globalX <= toX; ++globalX)
+                {
+                    int column = (globalY - originY) * ClimateTile::SIZE + (globalX - originX);
+                    outMap.Set(globalX, globalY, SelectBiome(tile->temperature[column], tile->humidity[column],
+                                                             tile->continentalness[column], tile->erosion[column],
+                                                             tile->peaksValleys[column]));
+                }
+            }
+        }
+    }
+}
+
+std::shared_ptr<const ClimateTile> SimpleMinerGenerator::GetClimateTile(int tileX, int tileY) const
+{
+    if (!m_climateCache)
+    {
+        return ComputeClimateTile(tileX, tileY);
+    }
+    ClimateTileKey key{tileX, tileY, m_worldSeed};
+    return m_climateCache->GetOrCreate(key, [&]() { return ComputeClimateTile(tileX, tileY); });
+}
+
+std::shared_ptr<const ClimateTile> SimpleMinerGenerator::ComputeClimateTile(int tileX, int tileY) const
+{
+    // Climate noise is sampled a whole row at a time (SIMD when batch noise is enabled)
+    auto      tile    = std::make_shared<ClimateTile>();
+    const int originX = tileX * ClimateTile::SIZE;
+    for (int y = 0; y < ClimateTile::SIZE; ++y)
+    {
+        const int globalY = tileY * ClimateTile::SIZE + y;
+        const int row     = y * ClimateTile::SIZE;
+        SampleNoise2DRow(originX, globalY, ClimateTile::SIZE, NoiseType::Temperature, tile->temperature + row);
+        SampleNoise2DRow(originX, globalY, ClimateTile::SIZE, NoiseType::Humidity, tile->humidity + row);
+        SampleNoise2DRow(originX, globalY, ClimateTile::SIZE, NoiseType::Continentalness, tile->continentalness + row);
+        SampleNoise2DRow(originX, globalY, ClimateTile::SIZE, NoiseType::Erosion, tile->erosion + row);
+        SampleNoise2DRow(originX, globalY, ClimateTile::SIZE, NoiseType::PeaksValleys, tile->peaksValleys + row);
+    }
+    return tile;
+}
+
+BiomeId SimpleMinerGenerator::SelectBiome(float T, float H, float C, float E, float PV) const
+{
+    // Classify parameters, then one table lookup instead of the decision tree
+    return m_biomeTable[BiomeTableIndex(ClassifyContinentalness(C), ClassifyTemperature(T), ClassifyHumidity(H),
+                                        ClassifyPeaksValleys(PV), ClassifyErosion(E))];
+}
 
+BiomeId SimpleMinerGenerator::ClassifyBiome(ContinentalnessCategory cCat, TemperatureCategory tCat, HumidityCategory hCat,
+                                            PeaksValleysCategory    pvCat, ErosionCategory    eCat) const
+{
     // ========== Layer 1: Continentalness-based selection ==========
 
     // Non-inland biomes (Ocean biomes)
@@ -860,13 +1366,13 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
     {
         // Frozen Ocean: T0 (temperature < -0.45)
         if (tCat == TemperatureCategory::T0)
-            return m_frozenOceanBiome;
+            return BiomeId::FrozenOcean;
 
         // Deep Ocean vs Ocean
         if (cCat == ContinentalnessCategory::DEEP_OCEAN)
-            return m_deepOceanBiome;
+            return BiomeId::DeepOcean;
         else
-            return m_oceanBiome;
+            return BiomeId::Ocean;
     }
 
     // ========== Layer 2: PV + Erosion-based selection ==========
@@ -877,14 +1383,14 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
     {
         // Snowy Beach: T0
         if (tCat == TemperatureCategory::T0)
-            return m_snowyBeachBiome;
+            return BiomeId::SnowyBeach;
 
         // Desert: T4 (hot)
         if (tCat == TemperatureCategory::T4)
-            return m_desertBiome;
+            return BiomeId::Desert;
 
         // Default Beach
-        return m_beachBiome;
+        return BiomeId::Beach;
     }
 
     // Peak biomes (PV=High or PV=Peaks, E=E0)
@@ -893,10 +1399,10 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
     {
         // Snowy Peaks: T <= T2
         if (tCat <= TemperatureCategory::T2)
-            return m_snowyPeaksBiome;
+            return BiomeId::SnowyPeaks;
 
         // Stony Peaks: T > T2
-        return m_stonyPeaksBiome;
+        return BiomeId::StonyPeaks;
     }
 
     // ========== Layer 3: Temperature + Humidity-based selection (Middle biomes) ==========
@@ -906,10 +1412,10 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
     {
         // Savanna: H3-H4 (humid)
         if (hCat >= HumidityCategory::H3)
-            return m_savannaBiome;
+            return BiomeId::Savanna;
 
         // Desert: H0-H2 (dry)
-        return m_desertBiome;
+        return BiomeId::Desert;
     }
 
     // Middle biomes lookup table (T0-T3 × H0-H4)
@@ -921,11 +1427,11 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
         case HumidityCategory::H0:
         case HumidityCategory::H1:
         case HumidityCategory::H2:
-            return m_snowyPlainsBiome;
+            return BiomeId::SnowyPlains;
         case HumidityCategory::H3:
-            return m_snowyTaigaBiome;
+            return BiomeId::SnowyTaiga;
         case HumidityCategory::H4:
-            return m_taigaBiome;
+            return BiomeId::Taiga;
         }
         break;
 
@@ -934,12 +1440,12 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
         {
         case HumidityCategory::H0:
         case HumidityCategory::H1:
-            return m_plainsBiome;
+            return BiomeId::Plains;
         case HumidityCategory::H2:
-            return m_forestBiome;
+            return BiomeId::Forest;
         case HumidityCategory::H3:
         case HumidityCategory::H4:
-            return m_taigaBiome;
+            return BiomeId::Taiga;
         }
         break;
 
@@ -948,12 +1454,12 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
         {
         case HumidityCategory::H0:
         case HumidityCategory::H1:
-            return m_plainsBiome;
+            return BiomeId::Plains;
         case HumidityCategory::H2:
         case HumidityCategory::H3:
-            return m_forestBiome;
+            return BiomeId::Forest;
         case HumidityCategory::H4:
-            return m_jungleBiome;
+            return BiomeId::Jungle;
         }
         break;
 
@@ -962,21 +1468,21 @@ std::shared_ptr<Biome> SimpleMinerGenerator::GetBiomeAt(int globalX, int globalY
         {
         case HumidityCategory::H0:
         case HumidityCategory::H1:
-            return m_savannaBiome;
+            return BiomeId::Savanna;
         case HumidityCategory::H2:
-            return m_plainsBiome;
+            return BiomeId::Plains;
         case HumidityCategory::H3:
         case HumidityCategory::H4:
-            return m_jungleBiome;
+            return BiomeId::Jungle;
         }
         break;
 
     case TemperatureCategory::T4: // 炎热(已在上面处理)
-        return m_desertBiome;
+        return BiomeId::Desert;
     }
 
     // Fallback
-    return m_plainsBiome;
+    return BiomeId::Plains;
 }
 
 void SimpleMinerGenerator::InitializeNoiseGenerators()
@@ -1054,6 +1560,223 @@ void SimpleMinerGenerator::InitializeNoiseGenerators()
     );
 
     LogInfo(LogWorldGenerator, "Initialized noise generators with professor's final parameters (Blog: Oct 21, 2025)");
+
+    // A table backend replaces the engine / batch terrain noise (see SampleNoise2D / SampleNoise3D)
+    NoiseBasis tableBasis = NoiseBasis::Perlin;
+    if (TableNoise::ParseBasis(m_config.m_noiseBackend, tableBasis))
+    {
+        InitializeTableNoiseGenerators(tableBasis);
+    }
+    else if (m_config.m_useBatchNoise)
+    {
+        InitializeBatchNoiseGenerators();
+    }
+    if (m_config.m_noiseBenchmark)
+    {
+        RunNoiseBackendBenchmark();
+    }
+    if (m_config.m_useCaves)
+    {
+        InitializeCaveNoiseGenerators();
+    }
+}
+
+void SimpleMinerGenerator::InitializeBatchNoiseGenerators()
+{
+    // 与引擎噪声使用完全相同的 seed / scale / octaves / persistence / octaveScale
+    // 注意：BatchPerlinNoise 是独立实现（不同的梯度哈希），因此生成的世界与引擎 Perlin 不同
+    m_batchTemperatureNoise = std::make_unique<BatchPerlinNoise>(
+        m_worldSeed + static_cast<unsigned int>(NoiseType::Temperature), TEMPERATURE_NOISE_SCALE, TEMPERATURE_NOISE_OCTAVES, 0.5f, 2.0f, true);
+    m_batchHumidityNoise = std::make_unique<BatchPerlinNoise>(
+        m_worldSeed + static_cast<unsigned int>(NoiseType::Humidity), HUMIDITY_NOISE_SCALE, HUMIDITY_NOISE_OCTAVES, 0.5f, 2.0f, true);
+    m_batchContinentalnessNoise = std::make_unique<BatchPerlinNoise>(
+        m_worldSeed + static_cast<unsigned int>(NoiseType::Continentalness), CONTINENTAL_NOISE_SCALE, CONTINENTAL_NOISE_OCTAVES, 0.5f, 2.0f, true);
+    m_batchErosionNoise = std::make_unique<BatchPerlinNoise>(
+        m_worldSeed + static_cast<unsigned int>(NoiseType::Erosion), EROSION_NOISE_SCALE, EROSION_NOISE_OCTAVES, 0.5f, 2.0f, true);
+    m_batchWeirdnessNoise = std::make_unique<BatchPerlinNoise>(
+        m_worldSeed + static_cast<unsigned int>(NoiseType::Weirdness), 100.0f, 1, 0.5f, 2.0f, true);
+    m_batchPeaksValleysNoise = std::make_unique<BatchPerlinNoise>(
+        m_worldSeed + static_cast<unsigned int>(NoiseType::PeaksValleys), PEAKS_VALLEYS_NOISE_SCALE, PEAKS_VALLEYS_NOISE_OCTAVES, 0.5f, 2.0f, true);
+    m_batchDensityNoise3D = std::make_unique<BatchPerlinNoise>(
+        m_worldSeed, DENSITY_NOISE_SCALE, DENSITY_NOISE_OCTAVES, 0.5f, 2.0f, true);
+
+    // 选择 SIMD 指令集：auto 使用 CPU 支持的最高级别，否则按配置强制（不超过 CPU 支持的级别）
+    NoiseSimdLevel level = BatchPerlinNoise::DetectSimdLevel();
+    if (m_config.m_batchNoiseSimd == "scalar")
+    {
+        level = NoiseSimdLevel::Scalar;
+    }
+    else if (m_config.m_batchNoiseSimd == "sse4.1" && level == NoiseSimdLevel::AVX2)
+    {
+        level = NoiseSimdLevel::SSE41;
+    }
+
+    // SIMD 结果必须与标量路径逐位一致，否则回退到标量（例如编译器开启了 FMA 合并）
+    if (!m_batchDensityNoise3D->VerifySimdLevel(level))
+    {
+        LogWarn(LogWorldGenerator, "Batch noise %s kernel is not bit-identical to the scalar path, falling back to scalar",
+                BatchPerlinNoise::GetSimdLevelName(level));
+        level = NoiseSimdLevel::Scalar;
+    }
+
+    m_batchTemperatureNoise->SetSimdLevel(level);
+    m_batchHumidityNoise->SetSimdLevel(level);
+    m_batchContinentalnessNoise->SetSimdLevel(level);
+    m_batchErosionNoise->SetSimdLevel(level);
+    m_batchWeirdnessNoise->SetSimdLevel(level);
+    m_batchPeaksValleysNoise->SetSimdLevel(level);
+    m_batchDensityNoise3D->SetSimdLevel(level);
+
+    // 编译期参数的密度噪声内核：必须与运行时参数路径逐位一致，否则保留运行时路径
+    if (m_config.m_batchNoiseFixed)
+    {
+        m_fixedDensityNoise3D = std::make_unique<FixedBatchPerlinNoise<DensityNoiseTraits>>(m_worldSeed);
+        m_fixedDensityNoise3D->SetSimdLevel(level);
+        if (!m_fixedDensityNoise3D->VerifyAgainst(*m_batchDensityNoise3D))
+        {
+            LogWarn(LogWorldGenerator, "Fixed density noise kernel is not bit-identical to the runtime path, using runtime parameters");
+            m_fixedDensityNoise3D.reset();
+        }
+    }
+
+    LogInfo(LogWorldGenerator, "Batch noise enabled (%s kernels, %s density kernel)", BatchPerlinNoise::GetSimdLevelName(level),
+            m_fixedDensityNoise3D ? "fixed" : "runtime");
+}
+
+void SimpleMinerGenerator::InitializeTableNoiseGenerators(NoiseBasis basis)
+{
+    // Same scale / octaves as the engine noise; the channel seed offset is the NoiseType (density last)
+    m_noiseTable = std::make_unique<NoiseGradientTable>(m_worldSeed);
+    const NoiseGradientTable* table = m_noiseTable.get();
+
+    struct ChannelParams
+    {
+        NoiseType    type;
+        float        scale;
+        unsigned int octaves;
+    };
+    const ChannelParams channels[] = {
+        {NoiseType::Temperature, TEMPERATURE_NOISE_SCALE, TEMPERATURE_NOISE_OCTAVES},
+        {NoiseType::Humidity, HUMIDITY_NOISE_SCALE, HUMIDITY_NOISE_OCTAVES},
+        {NoiseType::Continentalness, CONTINENTAL_NOISE_SCALE, CONTINENTAL_NOISE_OCTAVES},
+        {NoiseType::Erosion, EROSION_NOISE_SCALE, EROSION_NOISE_OCTAVES},
+        {NoiseType::Weirdness, 100.0f, 1},
+        {NoiseType::PeaksValleys, PEAKS_VALLEYS_NOISE_SCALE, PEAKS_VALLEYS_NOISE_OCTAVES},
+    };
+    static_assert(std::size(channels) == NOISE_TYPE_COUNT, "One table noise channel per NoiseType");
+
+    for (const ChannelParams& channel : channels)
+    {
+        m_tableNoise2D[static_cast<size_t>(channel.type)] = std::make_unique<TableNoise>(
+            table, basis, static_cast<uint32_t>(channel.type), channel.scale, channel.octaves, 0.5f, 2.0f, true);
+    }
+    m_tableDensityNoise3D = std::make_unique<TableNoise>(
+        table, basis, static_cast<uint32_t>(NOISE_TYPE_COUNT), DENSITY_NOISE_SCALE, DENSITY_NOISE_OCTAVES, 0.5f, 2.0f, true);
+
+    LogInfo(LogWorldGenerator, "Table noise enabled (%s basis, shared %zu-byte table)", TableNoise::GetBasisName(basis), sizeof(NoiseGradientTable));
+}
+
+void SimpleMinerGenerator::RunNoiseBackendBenchmark() const
+{
+    // Density noise shaped exactly like the shape stage (ApplyColumnShaping, solid if < 0) over a
+    // fixed block of the world; the column terms are shared, so only the density noise differs
+    constexpr int BENCH_SIZE_XY = 32;
+    constexpr int BENCH_SIZE_Z  = Chunk::CHUNK_SIZE_Z;
+    constexpr int SAMPLE_COUNT  = BENCH_SIZE_XY * BENCH_SIZE_XY * BENCH_SIZE_Z;
+
+    NoiseGradientTable table(m_worldSeed);
+    BatchPerlinNoise   batchNoise(m_worldSeed, DENSITY_NOISE_SCALE, DENSITY_NOISE_OCTAVES, 0.5f, 2.0f, true);
+
+    std::vector<ColumnShapeParams> columnShape(BENCH_SIZE_XY * BENCH_SIZE_XY);
+    for (int y = 0; y < BENCH_SIZE_XY; ++y)
+    {
+        for (int x = 0; x < BENCH_SIZE_XY; ++x)
+        {
+            columnShape[y * BENCH_SIZE_XY + x] = EvaluateColumnShape(x, y);
+        }
+    }
+
+    std::vector<uint8_t> referenceSolid;
+    std::vector<uint8_t> solid(SAMPLE_COUNT);
+    std::vector<float>   column(BENCH_SIZE_Z);
+
+    auto runBackend = [&](const char* name, const auto& sampleColumn)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (int y = 0; y < BENCH_SIZE_XY; ++y)
+        {
+            for (int x = 0; x < BENCH_SIZE_XY; ++x)
+            {
+                sampleColumn(static_cast<float>(x), static_cast<float>(y), column.data());
+                const ColumnShapeParams& shape = columnShape[y * BENCH_SIZE_XY + x];
+                for (int z = 0; z < BENCH_SIZE_Z; ++z)
+                {
+                    float density = ApplyColumnShaping(shape, column[z], z);
+                    solid[(y * BENCH_SIZE_XY + x) * BENCH_SIZE_Z + z] = density < 0.0f ? 1 : 0;
+                }
+            }
+        }
+        double nsPerSample = static_cast<double>(ElapsedMicros(start)) * 1000.0 / SAMPLE_COUNT;
+
+        // FNV-1a over the solid mask; differences are counted against the first (engine) backend
+        uint64_t hash        = CONTENT_HASH_OFFSET;
+        int      differences = 0;
+        for (int i = 0; i < SAMPLE_COUNT; ++i)
+        {
+            hash = (hash ^ solid[i]) * CONTENT_HASH_PRIME;
+            if (!referenceSolid.empty() && referenceSolid[i] != solid[i])
+            {
+                ++differences;
+            }
+        }
+        if (referenceSolid.empty())
+        {
+            referenceSolid = solid;
+        }
+
+        LogInfo(LogWorldGenerator, "Noise backend %-22s %8.1f ns/sample  solid hash %016llx  %6.2f%% voxels differ from engine",
+                name, nsPerSample, static_cast<unsigned long long>(hash), 100.0 * differences / SAMPLE_COUNT);
+    };
+
+    runBackend("classic (engine)", [&](float x, float y, float* out)
+    {
+        for (int z = 0; z < BENCH_SIZE_Z; ++z)
+        {
+            out[z] = m_densityNoise3D->Sample(x, y, static_cast<float>(z));
+        }
+    });
+    runBackend("classic (batch)", [&](float x, float y, float* out)
+    {
+        batchNoise.Sample3DColumn(x, y, 0.0f, 1.0f, out, BENCH_SIZE_Z);
+    });
+    for (NoiseBasis basis : {NoiseBasis::Perlin, NoiseBasis::OpenSimplex2, NoiseBasis::ValueGradient})
+    {
+        TableNoise tableNoise(&table, basis, static_cast<uint32_t>(NOISE_TYPE_COUNT), DENSITY_NOISE_SCALE, DENSITY_NOISE_OCTAVES, 0.5f, 2.0f, true);
+        runBackend(TableNoise::GetBasisName(basis), [&](float x, float y, float* out)
+        {
+            tableNoise.Sample3DColumn(x, y, 0.0f, 1.0f, out, BENCH_SIZE_Z);
+        });
+    }
+}
+
+void SimpleMinerGenerator::InitializeCaveNoiseGenerators()
+{
+    // Cheese: large blobs; spaghetti: the thin zero-crossing band shared by two noises forms tunnels
+    m_caveCheeseNoise     = std::make_unique<BatchPerlinNoise>(m_worldSeed + CAVE_CHEESE_SEED, 48.0f, 2, 0.5f, 2.0f, true);
+    m_caveSpaghettiNoiseA = std::make_unique<BatchPerlinNoise>(m_worldSeed + CAVE_SPAGHETTI_A_SEED, 40.0f, 1, 0.5f, 2.0f, true);
+    m_caveSpaghettiNoiseB = std::make_unique<BatchPerlinNoise>(m_worldSeed + CAVE_SPAGHETTI_B_SEED, 40.0f, 1, 0.5f, 2.0f, true);
+
+    // Caves must not depend on the CPU either: same bit-identity check as the terrain noise
+    NoiseSimdLevel level = BatchPerlinNoise::DetectSimdLevel();
+    if (!m_caveCheeseNoise->VerifySimdLevel(level))
+    {
+        LogWarn(LogWorldGenerator, "Cave noise %s kernel is not bit-identical to the scalar path, falling back to scalar",
+                BatchPerlinNoise::GetSimdLevelName(level));
+        level = NoiseSimdLevel::Scalar;
+    }
+    m_caveCheeseNoise->SetSimdLevel(level);
+    m_caveSpaghettiNoiseA->SetSimdLevel(level);
+    m_caveSpaghettiNoiseB->SetSimdLevel(level);
 }
 
 
@@ -1076,6 +1799,10 @@ float SimpleMinerGenerator::SamplePeaksValleys(int globalX, int globalY) const
 
 float SimpleMinerGenerator::EvaluateHeightOffset(float continentalness) const
 {
+    if (m_heightOffsetLut.Contains(continentalness))
+    {
+        return m_heightOffsetLut.Evaluate(continentalness);
+    }
     if (m_heightOffsetSpline)
     {
         return m_heightOffsetSpline->EvaluateSpline(continentalness);
@@ -1085,6 +1812,10 @@ float SimpleMinerGenerator::EvaluateHeightOffset(float continentalness) const
 
 float SimpleMinerGenerator::EvaluateSquashing(float continentalness) const
 {
+    if (m_squashingLut.Contains(continentalness))
+    {
+        return m_squashingLut.Evaluate(continentalness);
+    }
     if (m_squashingSpline)
     {
         return m_squashingSpline->EvaluateSpline(continentalness);
@@ -1094,6 +1825,10 @@ float SimpleMinerGenerator::EvaluateSquashing(float continentalness) const
 
 float SimpleMinerGenerator::EvaluateErosion(float erosion) const
 {
+    if (m_erosionLut.Contains(erosion))
+    {
+        return m_erosionLut.Evaluate(erosion);
+    }
     if (m_erosionSpline)
     {
         return m_erosionSpline->EvaluateSpline(erosion);
@@ -1101,6 +1836,47 @@ float SimpleMinerGenerator::EvaluateErosion(float erosion) const
     return 0.0f;
 }
 
+void SimpleMinerGenerator::BakeSplineLuts()
+{
+    // Climate noise inputs live in [-1, 1]; anything outside falls back to the exact spline
+    struct LutSource
+    {
+        const char*                                   name;
+        const std::shared_ptr<SplineDensityFunction>& spline;
+        SplineLut&                                    lut;
+    };
+
+    const LutSource sources[] = {
+        {"height offset", m_heightOffsetSpline, m_heightOffsetLut},
+        {"squashing", m_squashingSpline, m_squashingLut},
+        {"erosion", m_erosionSpline, m_erosionLut},
+    };
+
+    for (const LutSource& source : sources)
+    {
+        if (!source.spline)
+        {
+            continue;
+        }
+
+        SplineDensityFunction* spline   = source.spline.get();
+        float                  maxError = 0.0f;
+        bool                   baked    = source.lut.Bake([spline](float input) { return spline->EvaluateSpline(input); },
+                                                          -1.0f, 1.0f, m_config.m_splineLutResolution,
+                                                          m_config.m_splineLutTolerance, &maxError);
+        if (baked)
+        {
+            LogInfo(LogWorldGenerator, "Baked %s spline LUT: %d entries, max error %g",
+                    source.name, m_config.m_splineLutResolution, maxError);
+        }
+        else
+        {
+            LogWarn(LogWorldGenerator, "%s spline LUT max error %g exceeds tolerance %g, using exact spline",
+                    source.name, maxError, m_config.m_splineLutTolerance);
+        }
+    }
+}
+
 float SimpleMinerGenerator::ComputePerlin2D(float        x, float           y, float          scale, unsigned int octaves,
                                             float        persistence, float octaveScale, bool wrap,
                                             unsigned int seed) const
@@ -1156,6 +1932,23 @@ float SimpleMinerGenerator::SampleNoise2D(int globalX, int globalZ, NoiseType ty
     float x = static_cast<float>(globalX);
     float z = static_cast<float>(globalZ);
 
+    if (const TableNoise* tableNoise = GetTableNoise2D(type))
+    {
+        float N = tableNoise->Sample2D(x, z);
+        return (type == NoiseType::PeaksValleys) ? FoldPeaksValleys(N) : N;
+    }
+
+    if (m_config.m_useBatchNoise)
+    {
+        const BatchPerlinNoise* batchNoise = GetBatchNoise2D(type);
+        if (!batchNoise)
+        {
+            return 0.0f;
+        }
+        float N = batchNoise->Sample2D(x, z);
+        return (type == NoiseType::PeaksValleys) ? FoldPeaksValleys(N) : N;
+    }
+
     switch (type)
     {
     case NoiseType::Temperature:
@@ -1170,20 +1963,87 @@ float SimpleMinerGenerator::SampleNoise2D(int globalX, int globalZ, NoiseType ty
         return m_weirdnessNoise->Sample2D(x, z);
     case NoiseType::PeaksValleys:
         {
-            // ========== 教授的 Ridges Folded 公式 (Course Blog: Ship It - Oct 21) ==========
-            // PV = 1 - |3|N| - 2|
-            // 这个公式创造了"脊状"地形特征，用于 Biome 选择
-            float N        = m_peaksValleysNoise->Sample2D(x, z); // N ∈ [-1, 1]
-            float absN     = std::abs(N);
-            float innerAbs = std::abs(3.0f * absN - 2.0f);
-            float pv       = 1.0f - innerAbs;
-            return pv; // PV ∈ [0, 1]
+            float N = m_peaksValleysNoise->Sample2D(x, z); // N ∈ [-1, 1]
+            return FoldPeaksValleys(N);
         }
     default:
         return 0.0f;
     }
 }
 
+void SimpleMinerGenerator::SampleNoise2DRow(int startX, int globalZ, int count, NoiseType type, float* out) const
+{
+    if (const TableNoise* tableNoise = GetTableNoise2D(type))
+    {
+        tableNoise->Sample2DRow(static_cast<float>(startX), 1.0f, static_cast<float>(globalZ), out, count);
+        if (type == NoiseType::PeaksValleys)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                out[i] = FoldPeaksValleys(out[i]);
+            }
+        }
+        return;
+    }
+
+    const BatchPerlinNoise* batchNoise = m_config.m_useBatchNoise ? GetBatchNoise2D(type) : nullptr;
+    if (!batchNoise)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            out[i] = SampleNoise2D(startX + i, globalZ, type);
+        }
+        return;
+    }
+
+    batchNoise->Sample2DRow(static_cast<float>(startX), 1.0f, static_cast<float>(globalZ), out, count);
+    if (type == NoiseType::PeaksValleys)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            out[i] = FoldPeaksValleys(out[i]);
+        }
+    }
+}
+
+const BatchPerlinNoise* SimpleMinerGenerator::GetBatchNoise2D(NoiseType type) const
+{
+    switch (type)
+    {
+    case NoiseType::Temperature:
+        return m_batchTemperatureNoise.get();
+    case NoiseType::Humidity:
+        return m_batchHumidityNoise.get();
+    case NoiseType::Continentalness:
+        return m_batchContinentalnessNoise.get();
+    case NoiseType::Erosion:
+        return m_batchErosionNoise.get();
+    case NoiseType::Weirdness:
+        return m_batchWeirdnessNoise.get();
+    case NoiseType::PeaksValleys:
+        return m_batchPeaksValleysNoise.get();
+    default:
+        return nullptr;
+    }
+}
+
+const TableNoise* SimpleMinerGenerator::GetTableNoise2D(NoiseType type) const
+{
+    size_t index = static_cast<size_t>(type);
+    return index < NOISE_TYPE_COUNT ? m_tableNoise2D[index].get() : nullptr;
+}
+
+float SimpleMinerGenerator::FoldPeaksValleys(float noise) const
+{
+    // ========== 教授的 Ridges Folded 公式 (Course Blog: Ship It - Oct 21) ==========
+    // PV = 1 - |3|N| - 2|
+    // 这个公式创造了"脊状"地形特征，用于 Biome 选择
+    float absN     = std::abs(noise);
+    float innerAbs = std::abs(3.0f * absN - 2.0f);
+    float pv       = 1.0f - innerAbs;
+    return pv; // PV ∈ [0, 1]
+}
+
 /**
  * @brief 3D噪声采样 - 用于密度场计算
  *
@@ -1198,6 +2058,19 @@ float SimpleMinerGenerator::SampleNoise2D(int globalX, int globalZ, NoiseType ty
  */
 float SimpleMinerGenerator::SampleNoise3D(int globalX, int globalY, int globalZ) const
 {
+    if (m_tableDensityNoise3D)
+    {
+        return m_tableDensityNoise3D->Sample3D(static_cast<float>(globalX), static_cast<float>(globalY), static_cast<float>(globalZ));
+    }
+    if (m_fixedDensityNoise3D)
+    {
+        return m_fixedDensityNoise3D->Sample3D(static_cast<float>(globalX), static_cast<float>(globalY), static_cast<float>(globalZ));
+    }
+    if (m_batchDensityNoise3D)
+    {
+        return m_batchDensityNoise3D->Sample3D(static_cast<float>(globalX), static_cast<float>(globalY), static_cast<float>(globalZ));
+    }
+
     return m_densityNoise3D->Sample(
         static_cast<float>(globalX),
         static_cast<float>(globalY),
@@ -1205,16 +2078,41 @@ float SimpleMinerGenerator::SampleNoise3D(int globalX, int globalY, int globalZ)
     );
 }
 
+void SimpleMinerGenerator::SampleNoise3DRow(int startX, int stepX, int globalY, int globalZ, int count, float* out) const
+{
+    if (m_tableDensityNoise3D)
+    {
+        m_tableDensityNoise3D->Sample3DRow(static_cast<float>(startX), static_cast<float>(stepX),
+                                           static_cast<float>(globalY), static_cast<float>(globalZ), out, count);
+        return;
+    }
+    if (m_fixedDensityNoise3D)
+    {
+        m_fixedDensityNoise3D->Sample3DRow(static_cast<float>(startX), static_cast<float>(stepX),
+                                           static_cast<float>(globalY), static_cast<float>(globalZ), out, count);
+        return;
+    }
+    if (m_batchDensityNoise3D)
+    {
+        m_batchDensityNoise3D->Sample3DRow(static_cast<float>(startX), static_cast<float>(stepX),
+                                           static_cast<float>(globalY), static_cast<float>(globalZ), out, count);
+        return;
+    }
+
+    for (int i = 0; i < count; ++i)
+    {
+        out[i] = SampleNoise3D(startX + i * stepX, globalY, globalZ);
+    }
+}
+
 // Multi-stage generation pipeline implementations
 // These methods are required by TerrainGenerator base class but currently unused.
-// All generation logic is handled in GenerateChunk() for now.
-// TODO: Refactor GenerateChunk() to use this 3-stage pipeline in future phases.
+// GenerateChunk() runs the game's own staged pipeline on staging buffers (Run*Stage).
 
 bool SimpleMinerGenerator::GenerateTerrainShape(Chunk* chunk, int32_t chunkX, int32_t chunkY)
 {
-    // Terrain shape generation (3D density field) is currently handled in GenerateChunk().
+    // Terrain shape generation (3D density field) is RunShapeStage() of GenerateChunk's pipeline.
     // This stub satisfies the TerrainGenerator interface requirement.
-    // Future refactoring will move density calculation logic here.
     UNUSED(chunk);
     UNUSED(chunkX);
     UNUSED(chunkY);
@@ -1229,11 +2127,53 @@ bool SimpleMinerGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32
         return false;
     }
 
+    // Standalone entry point (GenerateChunk applies the rules to its staging buffer directly):
+    // stage the chunk's current blocks, apply the rules and write them back
+    std::vector<uint16_t>& blockIds = GetThreadScratch().blockIds;
+    blockIds.resize(STAGING_SIZE);
+    LoadChunkIntoStaging(chunk, blockIds.data());
+    std::vector<int>& surfaceHeight = GetThreadScratch().surfaceHeight;
+    surfaceHeight.resize(STAGING_LAYER_SIZE);
+    BuildSurfaceHeightmap(blockIds.data(), surfaceHeight.data());
+    BiomeMap& biomeMap = GetThreadScratch().biomeMap;
+    BuildBiomeMap(chunkX * Chunk::CHUNK_SIZE_X, chunkY * Chunk::CHUNK_SIZE_Y,
+                  chunkX * Chunk::CHUNK_SIZE_X + Chunk::CHUNK_SIZE_X - 1, chunkY * Chunk::CHUNK_SIZE_Y + Chunk::CHUNK_SIZE_Y - 1, biomeMap);
+    ApplySurfaceRulesToStaging(blockIds.data(), surfaceHeight.data(), biomeMap, chunkX, chunkY);
+    return CommitStagingToChunk(chunk, blockIds.data(), nullptr);
+}
+
+void SimpleMinerGenerator::BuildSurfaceHeightmap(const uint16_t* blockIds, int* surfaceHeight) const
+{
+    // 从上往下搜索第一个固体方块（非空气、非水）
+    for (int localY = 0; localY < Chunk::CHUNK_SIZE_Y; localY++)
+    {
+        for (int localX = 0; localX < Chunk::CHUNK_SIZE_X; localX++)
+        {
+            int surfaceZ = -1;
+            for (int z = Chunk::CHUNK_SIZE_Z - 1; z >= 0; z--)
+            {
+                uint16_t blockId = blockIds[StagingIndex(localX, localY, z)];
+                if (blockId != STAGING_NO_BLOCK && blockId != m_airId && blockId != m_waterId)
+                {
+                    surfaceZ = z;
+                    break;
+                }
+            }
+            surfaceHeight[localY * Chunk::CHUNK_SIZE_X + localX] = surfaceZ;
+        }
+    }
+}
+
+void SimpleMinerGenerator::ApplySurfaceRulesToStaging(uint16_t* blockIds, const int* surfaceHeight, const BiomeMap& biomeMap,
+                                                      int32_t   chunkX, int32_t         chunkY) const
+{
     // ⚠️ 调试日志：确认函数被调用
-    static int callCount = 0;
-    if (callCount < 5)
+    // 计数为成员原子量：多个 ChunkGen 线程同时调用，且每个生成器单独计数
+    const int  logCall     = m_surfaceRuleLogCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    const bool logThisCall = logCall <= 5;
+    if (logThisCall)
     {
-        LogInfo(LogWorldGenerator, "ApplySurfaceRules called for chunk (%d, %d) - call #%d", chunkX, chunkY, ++callCount);
+        LogInfo(LogWorldGenerator, "ApplySurfaceRules called for chunk (%d, %d) - call #%d", chunkX, chunkY, logCall);
     }
 
     int surfaceBlocksSet = 0;
@@ -1249,8 +2189,9 @@ bool SimpleMinerGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32
             int globalX = chunkX * Chunk::CHUNK_SIZE_X + localX;
             int globalZ = chunkY * Chunk::CHUNK_SIZE_Y + localY;
 
-            // 2. 通过 GetBiomeAt() 获取该位置的 Biome
-            std::shared_ptr<Biome> biome = GetBiomeAt(globalX, globalZ);
+            // 2. 从本 chunk 的 BiomeMap 获取该位置的 Biome
+            BiomeId      biomeId = biomeMap.Get(globalX, globalZ);
+            const Biome* biome   = GetBiome(biomeId);
             if (!biome)
             {
                 biomeMissCount++;
@@ -1264,22 +2205,8 @@ bool SimpleMinerGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32
             // 3. 获取 Biome 的 SurfaceRules
             const Biome::SurfaceRules& rules = biome->GetSurfaceRules();
 
-            // 4. 找到该柱的表面高度（从上往下搜索第一个固体方块）
-            int surfaceZ = -1;
-            for (int z = Chunk::CHUNK_SIZE_Z - 1; z >= 0; z--)
-            {
-                auto* blockState = chunk->GetBlock(localX, localY, z);
-                if (blockState)
-                {
-                    int blockId = blockState->GetBlock()->GetNumericId();
-                    // 如果不是空气且不是水，则认为是固体方块
-                    if (blockId != m_airId && blockId != m_waterId)
-                    {
-                        surfaceZ = z;
-                        break;
-                    }
-                }
-            }
+            // 4. 该柱的表面高度（地形阶段输出的 heightmap，无需逐层扫描）
+            int surfaceZ = surfaceHeight[localY * Chunk::CHUNK_SIZE_X + localX];
 
             if (surfaceZ == -1)
             {
@@ -1307,11 +2234,7 @@ bool SimpleMinerGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32
             if (surfaceZ > 180) // 高海拔阈值
             {
                 // 检查 Biome 类型（高山 Biome）
-                std::string biomeName = biome->GetName();
-                if (biomeName.find("peaks") != std::string::npos ||
-                    biomeName.find("Peaks") != std::string::npos ||
-                    biomeName.find("mountain") != std::string::npos ||
-                    biomeName.find("Mountain") != std::string::npos)
+                if (biomeId == BiomeId::StonyPeaks || biomeId == BiomeId::SnowyPeaks)
                 {
                     shouldGenerateIce = true;
 
@@ -1330,19 +2253,17 @@ bool SimpleMinerGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32
             // 应用顶层方块
             if (shouldGenerateIce)
             {
-                auto iceBlock = GetCachedBlockById(iceBlockId);
-                if (iceBlock && iceBlock->GetDefaultState())
+                if (GetCachedDefaultState(iceBlockId))
                 {
-                    chunk->SetBlock(localX, localY, surfaceZ, iceBlock->GetDefaultState());
+                    blockIds[StagingIndex(localX, localY, surfaceZ)] = ToStagingId(iceBlockId);
                     surfaceBlocksSet++;
                 }
             }
             else
             {
-                auto topBlock = GetCachedBlockById(rules.topBlockId);
-                if (topBlock && topBlock->GetDefaultState())
+                if (GetCachedDefaultState(rules.topBlockId))
                 {
-                    chunk->SetBlock(localX, localY, surfaceZ, topBlock->GetDefaultState());
+                    blockIds[StagingIndex(localX, localY, surfaceZ)] = ToStagingId(rules.topBlockId);
                     surfaceBlocksSet++;
                 }
                 else
@@ -1355,12 +2276,11 @@ bool SimpleMinerGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32
             }
 
             // 5.2 设置填充层方块（如果 fillerDepth > 0）
-            for (int i = 1; i <= rules.fillerDepth && (surfaceZ - i) >= 0; i++)
+            if (GetCachedDefaultState(rules.fillerBlockId))
             {
-                auto fillerBlock = GetCachedBlockById(rules.fillerBlockId);
-                if (fillerBlock && fillerBlock->GetDefaultState())
+                for (int i = 1; i <= rules.fillerDepth && (surfaceZ - i) >= 0; i++)
                 {
-                    chunk->SetBlock(localX, localY, surfaceZ - i, fillerBlock->GetDefaultState());
+                    blockIds[StagingIndex(localX, localY, surfaceZ - i)] = ToStagingId(rules.fillerBlockId);
                 }
             }
 
@@ -1368,34 +2288,308 @@ bool SimpleMinerGenerator::ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32
             if (globalSurfaceZ < SEA_LEVEL)
             {
                 // 替换水下表层为 underwaterBlockId
-                auto underwaterBlock = GetCachedBlockById(rules.underwaterBlockId);
-                if (underwaterBlock && underwaterBlock->GetDefaultState())
+                if (GetCachedDefaultState(rules.underwaterBlockId))
                 {
-                    chunk->SetBlock(localX, localY, surfaceZ, underwaterBlock->GetDefaultState());
+                    blockIds[StagingIndex(localX, localY, surfaceZ)] = ToStagingId(rules.underwaterBlockId);
                 }
             }
         }
     }
 
     // ⚠️ 调试日志：统计信息
-    if (callCount <= 5)
+    if (logThisCall)
     {
         LogInfo(LogWorldGenerator, "ApplySurfaceRules - Chunk (%d, %d) stats: %d surface blocks set, %d biome misses, %d no-surface columns",
                 chunkX, chunkY, surfaceBlocksSet, biomeMissCount, noSurfaceCount);
     }
+}
+
+SimpleMinerGenerator::GenerationScratch::~GenerationScratch() = default;
+
+SimpleMinerGenerator::GenerationScratch& SimpleMinerGenerator::GetThreadScratch()
+{
+    // One instance per ChunkGen worker; GenerateChunk is not re-entrant on a thread
+    thread_local GenerationScratch scratch;
+    return scratch;
+}
+
+SimpleMinerTreeGenerator& SimpleMinerGenerator::AcquireTreeGenerator(GenerationScratch& scratch, uint32_t seed) const
+{
+    // A worker may outlive a generator (world reload); the instance ID can never match a destroyed one
+    if (!scratch.treeGenerator || scratch.treeGeneratorOwner != m_instanceId || scratch.treeGeneratorSeed != seed)
+    {
+        scratch.treeGenerator      = std::make_unique<SimpleMinerTreeGenerator>(seed, this, this, m_treeStampLibrary.get());
+        scratch.treeGenerator->SetPlacementMode(
+            m_config.m_treePlacement == "grid" ? TreePlacementMode::JitteredGrid : TreePlacementMode::NoiseMaxima, m_config.m_treeGridCellSize);
+        scratch.treeGeneratorOwner = m_instanceId;
+        scratch.treeGeneratorSeed  = seed;
+    }
+    return *scratch.treeGenerator;
+}
+
+uint16_t SimpleMinerGenerator::ToStagingId(int blockId)
+{
+    if (blockId < 0 || blockId >= STAGING_NO_BLOCK)
+    {
+        return STAGING_NO_BLOCK;
+    }
+    return static_cast<uint16_t>(blockId);
+}
+
+BlockState* SimpleMinerGenerator::GetCachedDefaultState(int blockId) const
+{
+    if (blockId < 0)
+    {
+        return nullptr;
+    }
+    if (blockId < static_cast<int>(m_defaultStateById.size()) && m_defaultStateById[blockId])
+    {
+        return m_defaultStateById[blockId];
+    }
+
+    // Not preloaded: fall back to the block cache / registry lookup
+    auto block = GetCachedBlockById(blockId);
+    return block ? block->GetDefaultState() : nullptr;
+}
+
+void SimpleMinerGenerator::LoadChunkIntoStaging(Chunk* chunk, uint16_t* blockIds) const
+{
+    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                auto* blockState = chunk->GetBlock(x, y, z);
+                blockIds[StagingIndex(x, y, z)] = (blockState && blockState->GetBlock())
+                                                      ? ToStagingId(blockState->GetBlock()->GetNumericId())
+                                                      : STAGING_NO_BLOCK;
+            }
+        }
+    }
+}
+
+bool SimpleMinerGenerator::CommitStagingToChunk(Chunk* chunk, const uint16_t* blockIds, ChunkGenerationToken* cancelToken) const
+{
+    // Engine Chunk has no bulk setter, so this is one SetBlock per voxel; the block state of each
+    // staged ID comes straight from m_defaultStateById (no hash lookups, no shared_ptr copies)
+    const uint16_t* staged = blockIds;
+    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        // chunk 只在这里被写入：每个 section 开始前确认 chunk 仍处于 Generating
+        if (cancelToken && z % CANCEL_POLL_LAYERS == 0 && cancelToken->IsCancelled())
+        {
+            return false;
+        }
 
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+        {
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x, ++staged)
+            {
+                if (*staged == STAGING_NO_BLOCK)
+                {
+                    continue;
+                }
+                BlockState* blockState = GetCachedDefaultState(*staged);
+                if (blockState)
+                {
+                    chunk->SetBlock(x, y, z, blockState);
+                }
+            }
+        }
+    }
     return true;
 }
 
+bool SimpleMinerGenerator::AbortGeneration(int32_t chunkX, int32_t chunkY, const char* stage) const
+{
+    // Scratch buffers are thread_local, so returning hands them straight to the worker's next chunk
+    LogDebug("SimpleMinerGenerator", "Chunk (%d, %d) generation cancelled in the %s stage", chunkX, chunkY, stage);
+    return false;
+}
+
+void SimpleMinerGenerator::CancelPendingGeneration()
+{
+    m_cancelEpoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+
 bool SimpleMinerGenerator::GenerateFeatures(Chunk* chunk, int32_t chunkX, int32_t chunkY)
 {
-    // Feature generation (trees, ores, structures) is currently handled in GenerateChunk().
-    // This stub satisfies the TerrainGenerator interface requirement.
-    // Future refactoring will move feature placement logic here.
-    UNUSED(chunk);
-    UNUSED(chunkX);
-    UNUSED(chunkY);
-    return true;
+    if (!chunk)
+    {
+        LogError(LogWorldGenerator, "GenerateFeatures - null chunk provided");
+        return false;
+    }
+
+    // Standalone entry point (GenerateChunk places features in RunFeatureStage): caves and ore veins
+    // only, trees need the biome map of a full pipeline run
+    GenerationScratch&     scratch  = GetThreadScratch();
+    std::vector<uint16_t>& blockIds = scratch.blockIds;
+    blockIds.resize(STAGING_SIZE);
+    LoadChunkIntoStaging(chunk, blockIds.data());
+    if (m_config.m_useCaves)
+    {
+        scratch.surfaceHeight.resize(STAGING_LAYER_SIZE);
+        BuildSurfaceHeightmap(blockIds.data(), scratch.surfaceHeight.data());
+        CarveCaves(blockIds.data(), scratch.surfaceHeight.data(), chunkX, chunkY, scratch.caveLattice);
+    }
+    if (m_config.m_useOreVeins)
+    {
+        PlaceOreVeins(blockIds.data(), chunkX, chunkY, m_worldSeed);
+    }
+    return CommitStagingToChunk(chunk, blockIds.data(), nullptr);
+}
+
+void SimpleMinerGenerator::PlaceOreVeins(uint16_t* blockIds, int32_t chunkX, int32_t chunkY, uint32_t seed) const
+{
+    const uint16_t stoneStagingId  = ToStagingId(m_stoneId);
+    const uint16_t oreStagingIds[] = {ToStagingId(m_coalOreId), ToStagingId(m_ironOreId), ToStagingId(m_goldOreId), ToStagingId(m_diamondOreId)};
+    static_assert(std::size(oreStagingIds) == std::size(ORE_VEIN_RULES), "One staging ID per ore vein rule");
+
+    for (size_t rule = 0; rule < std::size(ORE_VEIN_RULES); ++rule)
+    {
+        const OreVeinRule& vein         = ORE_VEIN_RULES[rule];
+        const uint16_t     oreStagingId = oreStagingIds[rule];
+        if (oreStagingId == STAGING_NO_BLOCK || stoneStagingId == STAGING_NO_BLOCK)
+        {
+            continue;
+        }
+
+        for (int veinIndex = 0; veinIndex < vein.veinsPerChunk; ++veinIndex)
+        {
+            // Each vein owns its stream, so changing one rule never moves the veins of another
+            FeatureRandom random(seed, chunkX, chunkY, ORE_STREAM_BASE + static_cast<uint32_t>(rule) * ORE_STREAMS_PER_RULE + veinIndex);
+            int           x = random.RangeInt(0, Chunk::CHUNK_SIZE_X - 1);
+            int           y = random.RangeInt(0, Chunk::CHUNK_SIZE_Y - 1);
+            int           z = random.RangeInt(vein.minZ, (std::min)(vein.maxZ, Chunk::CHUNK_SIZE_Z - 1));
+
+            // Random walk from the origin; blocks leaving the chunk are dropped (veins stay within their chunk)
+            for (int step = 0; step < vein.veinSize; ++step)
+            {
+                if (x >= 0 && x < Chunk::CHUNK_SIZE_X && y >= 0 && y < Chunk::CHUNK_SIZE_Y && z >= 0 && z < Chunk::CHUNK_SIZE_Z)
+                {
+                    uint16_t& block = blockIds[StagingIndex(x, y, z)];
+                    if (block == stoneStagingId)
+                    {
+                        block = oreStagingId;
+                    }
+                }
+
+                uint32_t direction = random.NextUInt() % 6;
+                int      delta     = (direction & 1) ? 1 : -1;
+                if (direction < 2)
+                {
+                    x += delta;
+                }
+                else if (direction < 4)
+                {
+                    y += delta;
+                }
+                else
+                {
+                    z += delta;
+                }
+            }
+        }
+    }
+}
+
+void SimpleMinerGenerator::CarveCaves(uint16_t* blockIds, const int* surfaceHeight, int32_t chunkX, int32_t chunkY, std::vector<float>& lattice) const
+{
+    const uint16_t airStagingId   = ToStagingId(m_airId);
+    const uint16_t waterStagingId = ToStagingId(m_waterId);
+    const uint16_t lavaStagingId  = ToStagingId(m_lavaId);
+    if (airStagingId == STAGING_NO_BLOCK || !m_caveCheeseNoise)
+    {
+        return;
+    }
+
+    // Highest carvable Z per column: everything above stays as the shape stage left it
+    int columnTop[STAGING_LAYER_SIZE];
+    int chunkTop = -1;
+    for (int column = 0; column < STAGING_LAYER_SIZE; ++column)
+    {
+        columnTop[column] = (std::min)(surfaceHeight[column] - CAVE_ROOF_THICKNESS, Chunk::CHUNK_SIZE_Z - 1);
+        chunkTop          = (std::max)(chunkTop, columnTop[column]);
+    }
+    if (chunkTop < CAVE_FLOOR_Z)
+    {
+        return;
+    }
+
+    // Sample each lattice column only as high as the columns interpolating from it need
+    lattice.resize(static_cast<size_t>(CAVE_NOISE_COUNT) * CAVE_POINTS_XY * CAVE_POINTS_XY * CAVE_POINTS_Z);
+    const BatchPerlinNoise* noises[CAVE_NOISE_COUNT] = {m_caveCheeseNoise.get(), m_caveSpaghettiNoiseA.get(), m_caveSpaghettiNoiseB.get()};
+    const int               baseX                    = chunkX * Chunk::CHUNK_SIZE_X;
+    const int               baseY                    = chunkY * Chunk::CHUNK_SIZE_Y;
+
+    for (int latticeY = 0; latticeY < CAVE_POINTS_XY; ++latticeY)
+    {
+        int minY = (std::max)(0, (latticeY - 1) * CAVE_CELL_XY);
+        int maxY = (std::min)(Chunk::CHUNK_SIZE_Y - 1, latticeY * CAVE_CELL_XY + CAVE_CELL_XY - 1);
+        for (int latticeX = 0; latticeX < CAVE_POINTS_XY; ++latticeX)
+        {
+            int minX = (std::max)(0, (latticeX - 1) * CAVE_CELL_XY);
+            int maxX = (std::min)(Chunk::CHUNK_SIZE_X - 1, latticeX * CAVE_CELL_XY + CAVE_CELL_XY - 1);
+
+            int top = -1;
+            for (int y = minY; y <= maxY; ++y)
+            {
+                for (int x = minX; x <= maxX; ++x)
+                {
+                    top = (std::max)(top, columnTop[y * Chunk::CHUNK_SIZE_X + x]);
+                }
+            }
+            if (top < CAVE_FLOOR_Z)
+            {
+                continue;
+            }
+
+            int   pointCount = (std::min)(top / CAVE_CELL_Z + 2, CAVE_POINTS_Z);
+            float sampleX    = static_cast<float>(baseX + latticeX * CAVE_CELL_XY);
+            float sampleY    = static_cast<float>(baseY + latticeY * CAVE_CELL_XY);
+            for (int noise = 0; noise < CAVE_NOISE_COUNT; ++noise)
+            {
+                noises[noise]->Sample3DColumn(sampleX, sampleY, 0.0f, static_cast<float>(CAVE_CELL_Z),
+                                              &lattice[CaveLatticeIndex(noise, latticeX, latticeY, 0)], pointCount);
+            }
+        }
+    }
+
+    const float* samples = lattice.data();
+    for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
+    {
+        int   cellY = y / CAVE_CELL_XY;
+        float fy    = static_cast<float>(y % CAVE_CELL_XY) / CAVE_CELL_XY;
+        for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+        {
+            int   cellX = x / CAVE_CELL_XY;
+            float fx    = static_cast<float>(x % CAVE_CELL_XY) / CAVE_CELL_XY;
+            int   top   = columnTop[y * Chunk::CHUNK_SIZE_X + x];
+
+            for (int z = CAVE_FLOOR_Z; z <= top; ++z)
+            {
+                uint16_t& block = blockIds[StagingIndex(x, y, z)];
+                if (block == airStagingId || block == waterStagingId || block == STAGING_NO_BLOCK)
+                {
+                    continue;
+                }
+
+                int   cellZ = z / CAVE_CELL_Z;
+                float fz    = static_cast<float>(z % CAVE_CELL_Z) / CAVE_CELL_Z;
+                bool  carve = InterpolateCaveNoise(samples, 0, cellX, cellY, cellZ, fx, fy, fz) > CHEESE_THRESHOLD;
+                if (!carve && std::fabs(InterpolateCaveNoise(samples, 1, cellX, cellY, cellZ, fx, fy, fz)) < SPAGHETTI_WIDTH)
+                {
+                    carve = std::fabs(InterpolateCaveNoise(samples, 2, cellX, cellY, cellZ, fx, fy, fz)) < SPAGHETTI_WIDTH;
+                }
+                if (carve)
+                {
+                    block = (z <= LAVA_LEVEL && lavaStagingId != STAGING_NO_BLOCK) ? lavaStagingId : airStagingId;
+                }
+            }
+        }
+    }
 }
 
 std::string SimpleMinerGenerator::GetConfigDescription() const
@@ -1411,82 +2605,420 @@ float SimpleMinerGenerator::Compute2dPerlinNoise(float        x, float
     return ::Compute2dPerlinNoise(x, y, scale, octaves, persistence, octaveScale, renormalize, seed);
 }
 
-float SimpleMinerGenerator::CalculateFinalDensity(int globalX, int globalY, int globalZ) const
+SimpleMinerGenerator::ColumnShapeParams SimpleMinerGenerator::EvaluateColumnShape(int globalX, int globalY) const
 {
-    // 复用现有函数计算地形参数
+    // 步骤1: 采样大陆度 (Continentalness) [-1, 1]
+    // 2D Perlin噪声，决定该位置是海洋(-1)还是大陆(+1)
     float continentalness = SampleContinentalness(globalX, globalY);
-    float erosion         = SampleErosion(globalX, globalY);
-
-    float h = EvaluateHeightOffset(continentalness);
-    float s = EvaluateSquashing(continentalness);
-    float e = EvaluateErosion(erosion);
 
-    // 基础密度 + Bias（与GenerateChunk完全一致）
-    float densityNoise = SampleNoise3D(globalX, globalY, globalZ);
-    float b_bias       = BIAS_PER_Z * (static_cast<float>(globalZ) - TERRAIN_BASE_HEIGHT);
-    float density      = densityNoise + b_bias;
+    // 步骤2: 采样侵蚀度 (Erosion) [-1, 1]
+    // 2D Perlin噪声，决定该位置是平坦(-1)还是崎岖(+1)
+    float erosion = SampleErosion(globalX, globalY);
 
-    // 应用地形塑形（与GenerateChunk完全一致）
-    density -= h; // Height offset
+    // 注意：PeaksValleys 在当前实现中只用于 Biome 选择，不参与密度计算，因此这里不再采样
+    return BuildColumnShape(continentalness, erosion);
+}
 
-    // Squashing factor
-    float dynamic_base = TERRAIN_BASE_HEIGHT + (h * (static_cast<float>(Chunk::CHUNK_SIZE_Z) / 2.0f));
-    if (dynamic_base <= 0.0f)
+SimpleMinerGenerator::ColumnShapeParams SimpleMinerGenerator::BuildColumnShape(float continentalness, float erosion) const
+{
+    ColumnShapeParams column;
+    column.continentalness = continentalness;
+    column.erosion         = erosion;
+
+    // 步骤3: 通过样条曲线计算地形参数
+    // h (Height Offset): 海洋区域(c=-1) h=-0.6 形成海底，大陆区域(c=+1) h=+0.6 抬升陆地
+    // s (Squashing):     海洋 s=0 不变形，过渡区域 s=2.0 增强垂直变化，大陆 s=-1.5 压缩地形
+    // e (Erosion):       平坦区域 e=-0.3 形成平原，崎岖区域 e=+0.6 形成峡谷
+    column.heightOffset  = EvaluateHeightOffset(column.continentalness);
+    column.squashing     = EvaluateSquashing(column.continentalness);
+    column.erosionFactor = EvaluateErosion(column.erosion);
+
+    // 计算动态基准高度（考虑 continentalness 的影响）
+    // ⚠️ 修复说明 (2025-11-02)：当 h < 0（深海）时 b 可能变成负数，
+    // 导致 t = (z - b) / b 的符号错误，因此确保 b > 0
+    column.dynamicBase = TERRAIN_BASE_HEIGHT + (column.heightOffset * (static_cast<float>(Chunk::CHUNK_SIZE_Z) / 2.0f));
+    if (column.dynamicBase <= 0.0f)
     {
-        dynamic_base = 1.0f;
+        column.dynamicBase = 1.0f; // 最小值为 1.0
     }
-    float t = (static_cast<float>(globalZ) - dynamic_base) / dynamic_base;
-    density += s * t;
 
-    // Erosion factor
-    density += e * t;
+    return column;
+}
+
+float SimpleMinerGenerator::ApplyColumnShaping(const ColumnShapeParams& column, float densityNoise, int globalZ) const
+{
+    // ========== 教授的 Density 计算公式 (1:1 复刻) ==========
+    // 来源: Course Blog (Oct 15 - Terrain Density and Bias; Oct 17 - Continents)
+    //
+    //   D(x, y, z) = N(x, y, z, s) + B(z),  B(z) = b × (z − t)
+    //   density -= h          (高度偏移)
+    //   density += s * t      (挤压因子, t = (z - b) / b)
+    //   density += e * t      (侵蚀因子, Minecraft 1.18+)
+
+    // 步骤 1: 基础 Density + Bias
+    float b_bias  = BIAS_PER_Z * (static_cast<float>(globalZ) - TERRAIN_BASE_HEIGHT);
+    float density = densityNoise + b_bias;
+
+    // 步骤 2: Continentalness Height Offset
+    density -= column.heightOffset;
+
+    // 步骤 3: Squashing Factor (归一化的垂直偏移)
+    float t  = (static_cast<float>(globalZ) - column.dynamicBase) / column.dynamicBase;
+    density += column.squashing * t;
+
+    // 步骤 4: Erosion Factor
+    density += column.erosionFactor * t;
 
     return density;
 }
 
-int SimpleMinerGenerator::GetGroundHeightAt(int globalX, int globalY) const
+void SimpleMinerGenerator::ComputeNoiseBand(ColumnShapeParams& column) const
 {
-    // 使用二分搜索查找地面高度
-    // 搜索范围: [0, CHUNK_SIZE_Z - 1]
-    // 当 density < 0.0f 时表示固体方块
-    // 返回最高的固体方块Z坐标
+    const int maxZ = Chunk::CHUNK_SIZE_Z - 1;
+    if (!m_config.m_useHeightBandCulling)
+    {
+        column.bandMinZ = 0;
+        column.bandMaxZ = maxZ;
+        return;
+    }
 
-    int low  = 0;
-    int high = Chunk::CHUNK_SIZE_Z - 1; // 128 - 1 = 127
+    // 每个 octave 的幅度有界，重新归一化后的密度噪声 ∈ [-bound, bound]
+    const float bound     = m_config.m_densityNoiseBound;
+    auto        isCertain = [&](int z)
+    {
+        return ApplyColumnShaping(column, bound, z) < 0.0f // 噪声最大时仍为实心
+            || ApplyColumnShaping(column, -bound, z) >= 0.0f; // 噪声最小时仍为空气
+    };
 
-    // 二分搜索: 查找最高的固体方块
-    // 目标: 找到最大的 z 使得 CalculateFinalDensity(globalX, globalY, z) < 0.0f
-    while (low < high)
+    // 从底部和顶部向内扫描，找到第一个不确定的高度（带内全部视为不确定，保守且精确）
+    int low = 0;
+    while (low <= maxZ && isCertain(low))
     {
-        // 向上取整的中点,避免死循环
-        int mid = (low + high + 1) / 2;
+        ++low;
+    }
+    int high = maxZ;
+    while (high >= low && isCertain(high))
+    {
+        --high;
+    }
 
-        // 采样完整的地形密度（包含所有塑形因子）
-        float density = CalculateFinalDensity(globalX, globalY, mid);
+    column.bandMinZ = low;
+    column.bandMaxZ = high;
+}
 
-        // density < 0.0f 表示固体方块
-        if (density < 0.0f)
+uint16_t SimpleMinerGenerator::ClassifySection(const std::vector<ColumnShapeParams>& columnShape, int minZ, int maxZ,
+                                               uint16_t stoneStagingId, uint16_t seaStagingId, uint16_t airStagingId) const
+{
+    // 远离 0 的端点密度才算确定，避免浮点舍入让区间内部翻转符号
+    constexpr float SIGN_MARGIN = 1.0e-3f;
+
+    int solidColumns = 0;
+    for (const ColumnShapeParams& column : columnShape)
+    {
+        if (column.bandMinZ <= column.bandMaxZ && column.bandMinZ <= maxZ && column.bandMaxZ >= minZ)
         {
-            // mid 是固体方块,尝试更高的位置
-            low = mid;
+            return STAGING_NO_BLOCK;
         }
-        else
+
+        float bottom = ApplyColumnShaping(column, 0.0f, minZ);
+        float top    = ApplyColumnShaping(column, 0.0f, maxZ);
+        if (std::fabs(bottom) < SIGN_MARGIN || std::fabs(top) < SIGN_MARGIN || (bottom < 0.0f) != (top < 0.0f))
+        {
+            return STAGING_NO_BLOCK;
+        }
+        solidColumns += (bottom < 0.0f) ? 1 : 0;
+    }
+
+    if (solidColumns == static_cast<int>(columnShape.size()))
+    {
+        return stoneStagingId;
+    }
+    if (solidColumns != 0)
+    {
+        return STAGING_NO_BLOCK;
+    }
+
+    // Empty everywhere: water below sea level, air above (a section across sea level holds both)
+    if (maxZ < SEA_LEVEL)
+    {
+        return seaStagingId;
+    }
+    return (minZ >= SEA_LEVEL) ? airStagingId : STAGING_NO_BLOCK;
+}
+
+float SimpleMinerGenerator::CalculateFinalDensity(int globalX, int globalY, int globalZ) const
+{
+    // 复用 GenerateChunk 的列参数与塑形函数，保证结果完全一致（包括 noise cell 插值模式）
+    ColumnShapeParams column       = EvaluateColumnShape(globalX, globalY);
+    float             densityNoise = SampleDensityNoise(globalX, globalY, globalZ);
+    return ApplyColumnShaping(column, densityNoise, globalZ);
+}
+
+void SimpleMinerGenerator::BuildNoiseLattice(int32_t chunkX, int32_t chunkY, int minZ, int maxZ, NoiseLattice& outLattice) const
+{
+    const int cellXY = m_config.m_noiseCellSizeXY;
+    const int cellZ  = m_config.m_noiseCellSizeZ;
+
+    const int minX = chunkX * Chunk::CHUNK_SIZE_X;
+    const int minY = chunkY * Chunk::CHUNK_SIZE_Y;
+
+    // Lattice points are aligned to global multiples of the cell size, one extra point past the last voxel
+    outLattice.originX = FloorDivide(minX, cellXY);
+    outLattice.originY = FloorDivide(minY, cellXY);
+    outLattice.originZ = 0;
+    outLattice.countX  = FloorDivide(minX + Chunk::CHUNK_SIZE_X - 1, cellXY) - outLattice.originX + 2;
+    outLattice.countY  = FloorDivide(minY + Chunk::CHUNK_SIZE_Y - 1, cellXY) - outLattice.originY + 2;
+    outLattice.countZ  = FloorDivide(Chunk::CHUNK_SIZE_Z - 1, cellZ) + 2;
+    outLattice.values.assign(static_cast<size_t>(outLattice.countX) * outLattice.countY * outLattice.countZ, 0.0f);
+    if (minZ > maxZ)
+    {
+        return; // 整个 chunk 都在高度带之外
+    }
+
+    // Only the lattice layers surrounding [minZ, maxZ] are ever interpolated
+    const int firstLayer = FloorDivide(minZ, cellZ) - outLattice.originZ;
+    const int lastLayer  = (std::min)(FloorDivide(maxZ, cellZ) + 1 - outLattice.originZ, outLattice.countZ - 1);
+
+    const size_t layerSize = static_cast<size_t>(outLattice.countX) * outLattice.countY;
+    float*       row       = outLattice.values.data() + static_cast<size_t>(firstLayer) * layerSize;
+    for (int iz = firstLayer; iz <= lastLayer; ++iz)
+    {
+        int globalZ = (outLattice.originZ + iz) * cellZ;
+        for (int iy = 0; iy < outLattice.countY; ++iy)
+        {
+            int globalY = (outLattice.originY + iy) * cellXY;
+            SampleNoise3DRow(outLattice.originX * cellXY, cellXY, globalY, globalZ, outLattice.countX, row);
+            row += outLattice.countX;
+        }
+    }
+}
+
+float SimpleMinerGenerator::SampleNoiseLattice(const NoiseLattice& lattice, int globalX, int globalY, int globalZ) const
+{
+    const int cellXY = m_config.m_noiseCellSizeXY;
+    const int cellZ  = m_config.m_noiseCellSizeZ;
+
+    int cellIndexX = FloorDivide(globalX, cellXY);
+    int cellIndexY = FloorDivide(globalY, cellXY);
+    int cellIndexZ = FloorDivide(globalZ, cellZ);
+
+    float fx = static_cast<float>(globalX - cellIndexX * cellXY) / static_cast<float>(cellXY);
+    float fy = static_cast<float>(globalY - cellIndexY * cellXY) / static_cast<float>(cellXY);
+    float fz = static_cast<float>(globalZ - cellIndexZ * cellZ) / static_cast<float>(cellZ);
+
+    const size_t strideY = static_cast<size_t>(lattice.countX);
+    const size_t strideZ = strideY * lattice.countY;
+    const size_t base    = static_cast<size_t>(cellIndexZ - lattice.originZ) * strideZ
+        + static_cast<size_t>(cellIndexY - lattice.originY) * strideY
+        + static_cast<size_t>(cellIndexX - lattice.originX);
+
+    const float* v = lattice.values.data() + base;
+    return TrilinearInterpolate(v[0], v[1], v[strideY], v[strideY + 1],
+                                v[strideZ], v[strideZ + 1], v[strideZ + strideY], v[strideZ + strideY + 1],
+                                fx, fy, fz);
+}
+
+float SimpleMinerGenerator::SampleNoise3DCell(int globalX, int globalY, int globalZ) const
+{
+    const int cellXY = m_config.m_noiseCellSizeXY;
+    const int cellZ  = m_config.m_noiseCellSizeZ;
+
+    int cellIndexX = FloorDivide(globalX, cellXY);
+    int cellIndexY = FloorDivide(globalY, cellXY);
+    int cellIndexZ = FloorDivide(globalZ, cellZ);
+
+    float fx = static_cast<float>(globalX - cellIndexX * cellXY) / static_cast<float>(cellXY);
+    float fy = static_cast<float>(globalY - cellIndexY * cellXY) / static_cast<float>(cellXY);
+    float fz = static_cast<float>(globalZ - cellIndexZ * cellZ) / static_cast<float>(cellZ);
+
+    int x0 = cellIndexX * cellXY;
+    int y0 = cellIndexY * cellXY;
+    int z0 = cellIndexZ * cellZ;
+    int x1 = x0 + cellXY;
+    int y1 = y0 + cellXY;
+    int z1 = z0 + cellZ;
+
+    return TrilinearInterpolate(SampleNoise3D(x0, y0, z0), SampleNoise3D(x1, y0, z0),
+                                SampleNoise3D(x0, y1, z0), SampleNoise3D(x1, y1, z0),
+                                SampleNoise3D(x0, y0, z1), SampleNoise3D(x1, y0, z1),
+                                SampleNoise3D(x0, y1, z1), SampleNoise3D(x1, y1, z1),
+                                fx, fy, fz);
+}
+
+float SimpleMinerGenerator::SampleDensityNoise(int globalX, int globalY, int globalZ) const
+{
+    if (m_config.m_useNoiseCells)
+    {
+        return SampleNoise3DCell(globalX, globalY, globalZ);
+    }
+    return SampleNoise3D(globalX, globalY, globalZ);
+}
+
+void SimpleMinerGenerator::CompareNoiseCells(int32_t chunkX, int32_t chunkY, const std::vector<ColumnShapeParams>& columnShape,
+                                             const NoiseLattice& lattice, uint64_t latticeMicros)
+{
+    // 对比模式：逐体素计算精确密度，统计 solid/air 判定不一致的比例以及两种模式的耗时
+    uint64_t mismatchCount = 0;
+    float    maxNoiseError = 0.0f;
+
+    uint64_t interpolateMicros = 0;
+    uint64_t exactMicros       = 0;
+
+    std::vector<float> interpolated(static_cast<size_t>(Chunk::CHUNK_SIZE_X) * Chunk::CHUNK_SIZE_Y * Chunk::CHUNK_SIZE_Z);
+
+    auto interpolateStart = std::chrono::steady_clock::now();
+    size_t index          = 0;
+    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
+    {
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
         {
-            // mid 是空气方块,尝试更低的位置
-            high = mid - 1;
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                interpolated[index++] = SampleNoiseLattice(lattice, chunkX * Chunk::CHUNK_SIZE_X + x, chunkY * Chunk::CHUNK_SIZE_Y + y, z);
+            }
         }
     }
+    interpolateMicros = ElapsedMicros(interpolateStart);
 
-    // 边界检查: 如果没有找到固体方块(全是空气),返回海平面
-    if (low == 0)
+    auto exactStart = std::chrono::steady_clock::now();
+    index           = 0;
+    for (int z = 0; z < Chunk::CHUNK_SIZE_Z; ++z)
     {
-        float densityAtZero = CalculateFinalDensity(globalX, globalY, 0);
-        if (densityAtZero >= 0.0f)
+        for (int y = 0; y < Chunk::CHUNK_SIZE_Y; ++y)
         {
-            // Z=0 也是空气,返回海平面作为默认值
-            return SEA_LEVEL;
+            for (int x = 0; x < Chunk::CHUNK_SIZE_X; ++x)
+            {
+                const ColumnShapeParams& column = columnShape[y * Chunk::CHUNK_SIZE_X + x];
+
+                float exactNoise = SampleNoise3D(chunkX * Chunk::CHUNK_SIZE_X + x, chunkY * Chunk::CHUNK_SIZE_Y + y, z);
+                float cellNoise  = interpolated[index++];
+
+                bool exactSolid = ApplyColumnShaping(column, exactNoise, z) < 0.0f;
+                bool cellSolid  = ApplyColumnShaping(column, cellNoise, z) < 0.0f;
+                if (exactSolid != cellSolid)
+                {
+                    mismatchCount++;
+                }
+                maxNoiseError = (std::max)(maxNoiseError, std::fabs(exactNoise - cellNoise));
+            }
         }
     }
+    exactMicros = ElapsedMicros(exactStart);
+
+    const uint64_t voxelCount = static_cast<uint64_t>(Chunk::CHUNK_SIZE_X) * Chunk::CHUNK_SIZE_Y * Chunk::CHUNK_SIZE_Z;
+    const uint64_t cellMicros = latticeMicros + interpolateMicros;
+
+    LogDebug(LogWorldGenerator,
+             "Noise cells chunk (%d, %d): %llu/%llu voxels differ (%.3f%%), max noise error %.4f, cell %llu us vs exact %llu us",
+             chunkX, chunkY,
+             static_cast<unsigned long long>(mismatchCount), static_cast<unsigned long long>(voxelCount),
+             100.0 * static_cast<double>(mismatchCount) / static_cast<double>(voxelCount), maxNoiseError,
+             static_cast<unsigned long long>(cellMicros), static_cast<unsigned long long>(exactMicros));
+
+    // 汇总统计：每 64 个 chunk 输出一次整体结果
+    uint64_t totalMismatch = m_compareMismatchCount.fetch_add(mismatchCount) + mismatchCount;
+    uint64_t totalExact    = m_compareExactMicros.fetch_add(exactMicros) + exactMicros;
+    uint64_t totalCell     = m_compareCellMicros.fetch_add(cellMicros) + cellMicros;
+    uint64_t totalChunks   = m_compareChunkCount.fetch_add(1) + 1;
+    if (totalChunks % 64 == 0)
+    {
+        LogInfo(LogWorldGenerator,
+                "Noise cell comparison over %llu chunks: %.4f%% voxels differ, cell %.2f ms/chunk vs exact %.2f ms/chunk (%.1fx)",
+                static_cast<unsigned long long>(totalChunks),
+                100.0 * static_cast<double>(totalMismatch) / static_cast<double>(totalChunks * voxelCount),
+                static_cast<double>(totalCell) / 1000.0 / static_cast<double>(totalChunks),
+                static_cast<double>(totalExact) / 1000.0 / static_cast<double>(totalChunks),
+                totalCell > 0 ? static_cast<double>(totalExact) / static_cast<double>(totalCell) : 0.0);
+    }
+}
+
+void SimpleMinerGenerator::CompareTreePlacement(SimpleMinerTreeGenerator& treeGenerator, int32_t chunkX, int32_t chunkY)
+{
+    // 对比模式：两种放置方式各枚举一次树点（不查询地面、不放置），比较树点数量与耗时
+    auto     noiseStart  = std::chrono::steady_clock::now();
+    int      noiseSites  = treeGenerator.CountTreeSites(chunkX, chunkY, TreePlacementMode::NoiseMaxima);
+    uint64_t noiseMicros = ElapsedMicros(noiseStart);
+
+    auto     gridStart  = std::chrono::steady_clock::now();
+    int      gridSites  = treeGenerator.CountTreeSites(chunkX, chunkY, TreePlacementMode::JitteredGrid);
+    uint64_t gridMicros = ElapsedMicros(gridStart);
+
+    LogDebug(LogWorldGenerator, "Tree placement chunk (%d, %d): noise %d sites in %llu us vs grid %d sites in %llu us",
+             chunkX, chunkY, noiseSites, static_cast<unsigned long long>(noiseMicros),
+             gridSites, static_cast<unsigned long long>(gridMicros));
+
+    // 汇总统计：每 64 个 chunk 输出一次整体结果
+    uint64_t totalNoiseSites  = m_treeCompareNoiseSites.fetch_add(static_cast<uint64_t>(noiseSites)) + static_cast<uint64_t>(noiseSites);
+    uint64_t totalGridSites   = m_treeCompareGridSites.fetch_add(static_cast<uint64_t>(gridSites)) + static_cast<uint64_t>(gridSites);
+    uint64_t totalNoiseMicros = m_treeCompareNoiseMicros.fetch_add(noiseMicros) + noiseMicros;
+    uint64_t totalGridMicros  = m_treeCompareGridMicros.fetch_add(gridMicros) + gridMicros;
+    uint64_t totalChunks      = m_treeCompareChunkCount.fetch_add(1) + 1;
+    if (totalChunks % 64 == 0)
+    {
+        LogInfo(LogWorldGenerator,
+                "Tree placement comparison over %llu chunks: noise %.2f sites %.3f ms/chunk vs grid %.2f sites %.3f ms/chunk (%.1fx)",
+                static_cast<unsigned long long>(totalChunks),
+                static_cast<double>(totalNoiseSites) / static_cast<double>(totalChunks),
+                static_cast<double>(totalNoiseMicros) / 1000.0 / static_cast<double>(totalChunks),
+                static_cast<double>(totalGridSites) / static_cast<double>(totalChunks),
+                static_cast<double>(totalGridMicros) / 1000.0 / static_cast<double>(totalChunks),
+                totalGridMicros > 0 ? static_cast<double>(totalNoiseMicros) / static_cast<double>(totalGridMicros) : 0.0);
+    }
+}
+
+int SimpleMinerGenerator::GetGroundHeightAt(int globalX, int globalY) const
+{
+    // 已生成的 chunk 返回精确高度，否则返回缓存的解析估计（均不再评估 3D 密度）
+    int height = m_heightmapService->GetSurfaceHeight(globalX, globalY);
+
+    // 边界检查: 如果没有固体方块(全是空气),返回海平面
+    return (height >= 0) ? height : SEA_LEVEL;
+}
+
+int SimpleMinerGenerator::GetExactSurfaceHeight(int globalX, int globalY) const
+{
+    return m_heightmapService->GetExactHeight(globalX, globalY);
+}
 
-    return low;
+int SimpleMinerGenerator::ScanSurfaceHeight(const ColumnShapeParams& column, int globalX, int globalY, bool exact) const
+{
+    // Top-down scan matching the terrain pass: outside the height band the noise cannot change
+    // solid/air, so those levels are decided with noise 0 (and the estimate uses 0 everywhere)
+    for (int z = Chunk::CHUNK_SIZE_Z - 1; z >= 0; --z)
+    {
+        float densityNoise = 0.0f;
+        if (exact && z >= column.bandMinZ && z <= column.bandMaxZ)
+        {
+            densityNoise = SampleDensityNoise(globalX, globalY, z);
+        }
+        if (ApplyColumnShaping(column, densityNoise, z) < 0.0f)
+        {
+            return z;
+        }
+    }
+    return -1;
+}
+
+int SimpleMinerGenerator::ComputeExactSurfaceHeight(int globalX, int globalY) const
+{
+    const int                          tileX  = FloorDivide(globalX, ClimateTile::SIZE);
+    const int                          tileY  = FloorDivide(globalY, ClimateTile::SIZE);
+    const int                          column = (globalY - tileY * ClimateTile::SIZE) * ClimateTile::SIZE + (globalX - tileX * ClimateTile::SIZE);
+    std::shared_ptr<const ClimateTile> tile   = GetClimateTile(tileX, tileY);
+
+    ColumnShapeParams shape = BuildColumnShape(tile->continentalness[column], tile->erosion[column]);
+    ComputeNoiseBand(shape);
+    return ScanSurfaceHeight(shape, globalX, globalY, true);
+}
+
+void SimpleMinerGenerator::EstimateSurfaceTile(int32_t tileX, int32_t tileY, int16_t* outHeights) const
+{
+    std::shared_ptr<const ClimateTile> tile = GetClimateTile(tileX, tileY);
+    for (int column = 0; column < ClimateTile::COLUMN_COUNT; ++column)
+    {
+        ColumnShapeParams shape   = BuildColumnShape(tile->continentalness[column], tile->erosion[column]);
+        int               globalX = tileX * ClimateTile::SIZE + column % ClimateTile::SIZE;
+        int               globalY = tileY * ClimateTile::SIZE + column / ClimateTile::SIZE;
+        outHeights[column] = static_cast<int16_t>(ScanSurfaceHeight(shape, globalX, globalY, false));
+    }
 }
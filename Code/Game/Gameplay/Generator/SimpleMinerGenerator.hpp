@@ -2,10 +2,24 @@
 #include "Engine/Voxel/Generation/TerrainGenerator.hpp"
 #include "Engine/Voxel/NoiseGenerator/PerlinNoiseGenerator.hpp"
 #include "Engine/Voxel/Function/SplineDensityFunction.hpp"
+#include "Engine/Voxel/Block/BlockState.hpp"
 #include "Engine/Math/IntVec2.hpp"
 #include "Engine/Core/Engine.hpp"
+#include "Game/Framework/WorldGenConfigParser.hpp"
+#include "Noise/BatchPerlinNoise.hpp"
+#include "Noise/TableNoise.hpp"
+#include "BiomeId.hpp"
+#include "BiomeMap.hpp"
+#include "ClimateTileCache.hpp"
+#include "HeightmapService.hpp"
+#include "ProtoChunkStatus.hpp"
+#include "SplineLut.hpp"
+#include "TreeStampLibrary.hpp"
+#include <array>
 #include <unordered_map>
 #include <memory>
+#include <atomic>
+#include <vector>
 
 #include "Engine/Core/LogCategory/LogCategory.hpp"
 
@@ -21,6 +35,9 @@ namespace enigma::registry::block
     class Block;
 }
 
+class ChunkGenerationToken;
+class SimpleMinerTreeGenerator;
+
 using namespace enigma::voxel;
 
 /**
@@ -59,6 +76,8 @@ private:
     // 3D Density Noise
     static constexpr float        DENSITY_NOISE_SCALE   = 64.0f; // 教授最终版本
     static constexpr unsigned int DENSITY_NOISE_OCTAVES = 8; // 教授最终版本
+    static_assert(DensityNoiseTraits::OCTAVES == DENSITY_NOISE_OCTAVES && DensityNoiseTraits::SCALE == DENSITY_NOISE_SCALE,
+                  "DensityNoiseTraits must match the density noise parameters");
 
     // Terrain Generation Constants
     static constexpr float TERRAIN_BASE_HEIGHT = 64.0f; // 基准高度 (海平面)
@@ -76,6 +95,8 @@ private:
         PeaksValleys = 5
     };
 
+    static constexpr size_t NOISE_TYPE_COUNT = 6;
+
     // ========== Climate Parameter Categories ==========
 
     // Continentalness Categories (6 levels)
@@ -131,17 +152,157 @@ private:
         E6 // e >= 0.55
     };
 
+    static constexpr size_t CONTINENTALNESS_CATEGORY_COUNT = 6;
+    static constexpr size_t TEMPERATURE_CATEGORY_COUNT     = 5;
+    static constexpr size_t HUMIDITY_CATEGORY_COUNT        = 5;
+    static constexpr size_t PEAKS_VALLEYS_CATEGORY_COUNT   = 5;
+    static constexpr size_t EROSION_CATEGORY_COUNT         = 7;
+
+    // One BiomeId per (C, T, H, PV, E) category combination
+    static constexpr size_t BIOME_TABLE_SIZE = CONTINENTALNESS_CATEGORY_COUNT * TEMPERATURE_CATEGORY_COUNT *
+        HUMIDITY_CATEGORY_COUNT * PEAKS_VALLEYS_CATEGORY_COUNT * EROSION_CATEGORY_COUNT;
+
+    // ========== Per-Column Terrain Parameters ==========
+
+    /**
+     * @brief Climate noise and spline results for a single (x, y) column
+     *
+     * None of these values depend on Z, so GenerateChunk evaluates them once per
+     * column (256 per chunk) and reuses them for every Z level of the 3D density loop.
+     */
+    struct ColumnShapeParams
+    {
+        float continentalness = 0.0f;
+        float erosion         = 0.0f;
+        float heightOffset    = 0.0f; // h: EvaluateHeightOffset(continentalness)
+        float squashing       = 0.0f; // s: EvaluateSquashing(continentalness)
+        float erosionFactor   = 0.0f; // e: EvaluateErosion(erosion)
+        float dynamicBase     = 1.0f; // b: TERRAIN_BASE_HEIGHT + h * (CHUNK_SIZE_Z / 2), always > 0
+
+        // Height band: Z range where solid/air depends on the 3D noise (empty if bandMinZ > bandMaxZ).
+        // Below/above it every voxel is certainly solid or certainly air for any noise in [-bound, bound].
+        int bandMinZ = 0;
+        int bandMaxZ = -1;
+    };
+
+    /**
+     * @brief Coarse lattice of raw 3D density noise covering one chunk (noise cell mode)
+     *
+     * Lattice points sit at global multiples of the cell size, so neighbouring chunks and
+     * CalculateFinalDensity() interpolate between exactly the same corner samples.
+     * Values are stored as [z][y][x].
+     */
+    struct NoiseLattice
+    {
+        int                originX = 0; // Cell index of the first lattice point
+        int                originY = 0;
+        int                originZ = 0;
+        int                countX  = 0; // Number of lattice points per axis
+        int                countY  = 0;
+        int                countZ  = 0;
+        std::vector<float> values;
+    };
+
+    /**
+     * @brief Per-worker buffers reused by GenerateChunk across chunks
+     *
+     * blockIds is the dense block staging buffer ([z][y][x] numeric block IDs, STAGING_NO_BLOCK
+     * = leave the chunk's block untouched). Terrain, water and surface rules only write here;
+     * CommitStagingToChunk() copies the result into the chunk in a single pass.
+     * surfaceHeight is the per-column topmost solid Z ([y][x], -1 = none) emitted by the terrain pass.
+     * treeGenerator is this worker's tree generator, rebuilt only when the generator instance or seed changes.
+     */
+    struct GenerationScratch
+    {
+        std::vector<uint16_t>          blockIds;
+        std::vector<int>               surfaceHeight;
+        BiomeMap                       biomeMap;
+        std::vector<ColumnShapeParams> columnShape;
+        NoiseLattice                   noiseLattice;
+        std::vector<float>             caveLattice; // Coarse cave noise samples of the feature stage
+
+        std::unique_ptr<SimpleMinerTreeGenerator> treeGenerator;
+        uint32_t                                  treeGeneratorOwner = 0; // m_instanceId of the generator it was built for
+        uint32_t                                  treeGeneratorSeed  = 0;
+
+        ~GenerationScratch();
+    };
+
+    /**
+     * @brief One chunk's pass through the generation pipeline (Climate -> Shape -> Surface -> Features -> Full)
+     *
+     * Stage outputs live in the worker's scratch buffers; status is the last completed stage.
+     * chunk is nullptr for detached runs (GenerateProtoChunk), which stop at Features at the latest.
+     * Verification runs (GenerateRegionHashes) have no chunk either but run the commit stage like a
+     * world chunk, committing into commitBuffer.
+     */
+    struct ProtoChunk
+    {
+        Chunk*                    chunk           = nullptr;
+        int32_t                   chunkX          = 0;
+        int32_t                   chunkY          = 0;
+        uint32_t                  seed            = 0;
+        ProtoChunkStatus          status          = ProtoChunkStatus::Empty;
+        GenerationScratch*        scratch         = nullptr;
+        ChunkGenerationToken*     cancelToken     = nullptr;
+        SimpleMinerTreeGenerator* treeGenerator   = nullptr; // Set by the climate stage
+        int                       bandUnionMinZ   = 0; // Union of the columns' noise bands (climate stage)
+        int                       bandUnionMaxZ   = -1;
+        int                       noiseVoxelCount = 0;
+        std::vector<uint16_t>*    commitBuffer    = nullptr; // Verification runs: staged blocks are committed here
+    };
+
+    static constexpr uint16_t STAGING_NO_BLOCK = 0xFFFF;
+
+    // Vertical section height used by the shape stage (uniform sections are filled without per-voxel work)
+    static constexpr int SECTION_HEIGHT = 16;
+    static_assert(Chunk::CHUNK_SIZE_Z % SECTION_HEIGHT == 0, "Chunk height must be a whole number of sections");
+
     // ========== Member Variables ==========
 
     // World seed
     uint32_t m_worldSeed;
 
+    // World generation tuning (noise cells, ...)
+    WorldGenConfig m_config;
+
+    // Noise cell comparison statistics (accumulated across ChunkGen threads)
+    std::atomic<uint64_t> m_compareChunkCount{0};
+    std::atomic<uint64_t> m_compareMismatchCount{0};
+    std::atomic<uint64_t> m_compareExactMicros{0};
+    std::atomic<uint64_t> m_compareCellMicros{0};
+
+    // Tree placement comparison statistics (accumulated across ChunkGen threads)
+    std::atomic<uint64_t> m_treeCompareChunkCount{0};
+    std::atomic<uint64_t> m_treeCompareNoiseSites{0};
+    std::atomic<uint64_t> m_treeCompareGridSites{0};
+    std::atomic<uint64_t> m_treeCompareNoiseMicros{0};
+    std::atomic<uint64_t> m_treeCompareGridMicros{0};
+
+    // Per-stage pipeline cost (accumulated across ChunkGen threads, indexed by ToStageIndex)
+    std::array<std::atomic<uint64_t>, PROTO_CHUNK_STAGE_COUNT> m_stageMicros{};
+    std::array<std::atomic<uint64_t>, PROTO_CHUNK_STAGE_COUNT> m_stageChunkCount{};
+    std::array<std::atomic<uint64_t>, FEATURE_STEP_COUNT>      m_featureStepMicros{}; // Split of the Features stage time
+    // Generations aborted by cancellation (their partial stage is not part of the averages above)
+    std::atomic<uint64_t> m_cancelledChunkCount{0};
+
+    // Pipeline status of the chunks being generated
+    ProtoChunkStatusMap m_protoChunkStatus;
+
+    // Bumped by CancelPendingGeneration(); in-flight chunks compare it against their start value
+    std::atomic<uint32_t> m_cancelEpoch{0};
+
     // Phase 2-4: Spline Density Functions
     std::shared_ptr<SplineDensityFunction> m_heightOffsetSpline; // Height offset based on continentalness
     std::shared_ptr<SplineDensityFunction> m_squashingSpline; // Squashing factor based on continentalness
     std::shared_ptr<SplineDensityFunction> m_erosionSpline; // Erosion influence
     std::shared_ptr<SplineDensityFunction> m_peaksValleysSpline; // Peaks/Valleys influence
 
+    // Baked tables of the splines above (empty if disabled or out of tolerance)
+    SplineLut m_heightOffsetLut;
+    SplineLut m_squashingLut;
+    SplineLut m_erosionLut;
+
     // Noise Generators
     std::unique_ptr<enigma::voxel::PerlinNoiseGenerator> m_temperatureNoise;
     std::unique_ptr<enigma::voxel::PerlinNoiseGenerator> m_humidityNoise;
@@ -151,9 +312,45 @@ private:
     std::unique_ptr<enigma::voxel::PerlinNoiseGenerator> m_peaksValleysNoise;
     std::unique_ptr<enigma::voxel::PerlinNoiseGenerator> m_densityNoise3D;
 
+    // Batch (SIMD) noise generators, only created when m_config.m_useBatchNoise is set
+    std::unique_ptr<BatchPerlinNoise> m_batchTemperatureNoise;
+    std::unique_ptr<BatchPerlinNoise> m_batchHumidityNoise;
+    std::unique_ptr<BatchPerlinNoise> m_batchContinentalnessNoise;
+    std::unique_ptr<BatchPerlinNoise> m_batchErosionNoise;
+    std::unique_ptr<BatchPerlinNoise> m_batchWeirdnessNoise;
+    std::unique_ptr<BatchPerlinNoise> m_batchPeaksValleysNoise;
+    std::unique_ptr<BatchPerlinNoise> m_batchDensityNoise3D;
+
+    // Compile-time density kernel (same samples as m_batchDensityNoise3D), unless m_config.m_batchNoiseFixed is off
+    std::unique_ptr<FixedBatchPerlinNoise<DensityNoiseTraits>> m_fixedDensityNoise3D;
+
+    // Shared-table noise channels, only created when m_config.m_noiseBackend names a table basis
+    // (indexed by NoiseType; all channels read m_noiseTable and differ only by seed offset)
+    std::unique_ptr<NoiseGradientTable> m_noiseTable;
+    std::unique_ptr<TableNoise>         m_tableNoise2D[NOISE_TYPE_COUNT];
+    std::unique_ptr<TableNoise>         m_tableDensityNoise3D;
+
+    // Cave noises of the feature stage, only created when m_config.m_useCaves is set
+    std::unique_ptr<BatchPerlinNoise> m_caveCheeseNoise;
+    std::unique_ptr<BatchPerlinNoise> m_caveSpaghettiNoiseA;
+    std::unique_ptr<BatchPerlinNoise> m_caveSpaghettiNoiseB;
+
+    // Climate tiles shared by all ChunkGen threads, only created when m_config.m_useClimateCache is set
+    std::unique_ptr<ClimateTileCache> m_climateCache;
+
+    // Generated / estimated surface heights for ground queries
+    std::unique_ptr<HeightmapService> m_heightmapService;
+
+    // Tree stamps shared read-only by every worker's tree generator
+    std::unique_ptr<const TreeStampLibrary> m_treeStampLibrary;
+
+    // Unique per generator object (never reused), so workers can tell a stale tree generator from a live one
+    uint32_t m_instanceId = 0;
+
     // Block ID Cache (for thread-safe access)
     std::unordered_map<std::string, int>                                     m_blockIdCache;
     std::unordered_map<int, std::shared_ptr<enigma::registry::block::Block>> m_blockByIdCache;
+    std::vector<enigma::voxel::BlockState*>                                  m_defaultStateById; // Indexed by numeric block ID
 
     // Common Block IDs (cached for performance)
     int m_airId        = -1;
@@ -187,35 +384,27 @@ private:
     int m_grassSnowId    = -1;
     int m_grassTaigaId   = -1;
 
-    // Phase 6: Biome Instances
-    std::shared_ptr<enigma::voxel::Biome> m_oceanBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_deepOceanBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_frozenOceanBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_beachBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_snowyBeachBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_desertBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_savannaBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_plainsBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_snowyPlainsBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_forestBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_jungleBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_taigaBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_snowyTaigaBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_stonyPeaksBiome;
-    std::shared_ptr<enigma::voxel::Biome> m_snowyPeaksBiome;
-
-    // Tree Block IDs (cached for performance)
-    mutable int m_oakLogId           = -1;
-    mutable int m_oakLeavesId        = -1;
-    mutable int m_birchLogId         = -1;
-    mutable int m_birchLeavesId      = -1;
-    mutable int m_spruceLogId        = -1;
-    mutable int m_spruceLeavesId     = -1;
-    mutable int m_spruceLeavesSnowId = -1;
-    mutable int m_jungleLogId        = -1;
-    mutable int m_jungleLeavesId     = -1;
-    mutable int m_acaciaLogId        = -1;
-    mutable int m_acaciaLeavesId     = -1;
+    // Phase 6: Biome Instances, indexed by BiomeId
+    std::array<std::shared_ptr<enigma::voxel::Biome>, BIOME_COUNT> m_biomes;
+
+    // Climate category combination -> biome, precomputed from ClassifyBiome() (see BiomeTableIndex)
+    std::array<BiomeId, BIOME_TABLE_SIZE> m_biomeTable;
+
+    // Tree Block IDs (cached for performance, set once in InitializeBlockCache)
+    int m_oakLogId           = -1;
+    int m_oakLeavesId        = -1;
+    int m_birchLogId         = -1;
+    int m_birchLeavesId      = -1;
+    int m_spruceLogId        = -1;
+    int m_spruceLeavesId     = -1;
+    int m_spruceLeavesSnowId = -1;
+    int m_jungleLogId        = -1;
+    int m_jungleLeavesId     = -1;
+    int m_acaciaLogId        = -1;
+    int m_acaciaLeavesId     = -1;
+
+    // Surface rule debug logging of the first chunks (shared by all ChunkGen threads)
+    mutable std::atomic<int> m_surfaceRuleLogCount{0};
 
     // ========== Private Helper Methods ==========
 
@@ -224,6 +413,26 @@ private:
      */
     void InitializeNoiseGenerators();
 
+    /**
+     * @brief Create the batch noise generators and pick (and verify) the SIMD kernel
+     */
+    void InitializeBatchNoiseGenerators();
+
+    /**
+     * @brief Create the shared table and one TableNoise per channel (replaces engine / batch terrain noise)
+     */
+    void InitializeTableNoiseGenerators(NoiseBasis basis);
+
+    /**
+     * @brief Log ns/sample and base density field differences of every noise backend (worldgen.noise.benchmark)
+     */
+    void RunNoiseBackendBenchmark() const;
+
+    /**
+     * @brief Create the cheese / spaghetti cave noises (independent of m_useBatchNoise)
+     */
+    void InitializeCaveNoiseGenerators();
+
     /**
      * @brief Initialize block cache for thread-safe access
      */
@@ -259,6 +468,22 @@ private:
      */
     ErosionCategory ClassifyErosion(float e) const;
 
+    /**
+     * @brief Biome decision tree over climate categories (Biomes.docx lookup rules)
+     *
+     * Only evaluated by BuildBiomeTable(); lookups go through m_biomeTable.
+     */
+    BiomeId ClassifyBiome(ContinentalnessCategory cCat, TemperatureCategory tCat, HumidityCategory hCat,
+                          PeaksValleysCategory    pvCat, ErosionCategory    eCat) const;
+
+    /**
+     * @brief Fill m_biomeTable with ClassifyBiome() of every category combination
+     */
+    void BuildBiomeTable();
+
+    static size_t BiomeTableIndex(ContinentalnessCategory cCat, TemperatureCategory tCat, HumidityCategory hCat,
+                                  PeaksValleysCategory    pvCat, ErosionCategory    eCat);
+
     /**
      * @brief Sample 2D noise for specific type
      * @param globalX World X coordinate
@@ -268,6 +493,28 @@ private:
      */
     float SampleNoise2D(int globalX, int globalZ, NoiseType type) const;
 
+    /**
+     * @brief Sample 2D noise for count consecutive X positions starting at startX
+     *
+     * Uses the SIMD batch kernels when batch noise is enabled, otherwise loops SampleNoise2D().
+     */
+    void SampleNoise2DRow(int startX, int globalZ, int count, NoiseType type, float* out) const;
+
+    /**
+     * @brief Batch noise generator backing a 2D noise type (nullptr if batch noise is disabled)
+     */
+    const BatchPerlinNoise* GetBatchNoise2D(NoiseType type) const;
+
+    /**
+     * @brief Table noise backing a 2D noise type (nullptr unless a table backend is selected)
+     */
+    const TableNoise* GetTableNoise2D(NoiseType type) const;
+
+    /**
+     * @brief Professor's ridges fold PV = 1 - |3|N| - 2| applied to raw peaks/valleys noise
+     */
+    float FoldPeaksValleys(float noise) const;
+
     /**
      * @brief Sample continentalness noise at position
      */
@@ -298,6 +545,11 @@ private:
      */
     float EvaluateErosion(float erosion) const;
 
+    /**
+     * @brief Bake the height offset / squashing / erosion splines into lookup tables
+     */
+    void BakeSplineLuts();
+
     /**
      * @brief Sample 3D density noise
      * @param globalX World X coordinate
@@ -307,6 +559,99 @@ private:
      */
     float SampleNoise3D(int globalX, int globalY, int globalZ) const;
 
+    /**
+     * @brief Sample 3D density noise for count points (startX + i * stepX, globalY, globalZ)
+     *
+     * Uses the SIMD batch kernels when batch noise is enabled, otherwise loops SampleNoise3D().
+     */
+    void SampleNoise3DRow(int startX, int stepX, int globalY, int globalZ, int count, float* out) const;
+
+    /**
+     * @brief Sample continentalness/erosion and evaluate the h/s/e splines for one column
+     * @param globalX World X coordinate
+     * @param globalY World Y coordinate
+     * @return Column parameters shared by every Z level of the column
+     */
+    ColumnShapeParams EvaluateColumnShape(int globalX, int globalY) const;
+
+    /**
+     * @brief Evaluate the h/s/e splines for already sampled continentalness/erosion values
+     */
+    ColumnShapeParams BuildColumnShape(float continentalness, float erosion) const;
+
+    /**
+     * @brief Find the Z band of a column whose solid/air state actually depends on the 3D density noise
+     *
+     * Float addition is monotonic, so if ApplyColumnShaping() with noise = +bound is still < 0 the voxel is
+     * solid for every noise value (and air if noise = -bound already gives >= 0). Voxels outside the band can
+     * use noise = 0 and produce exactly the same block as a full evaluation.
+     */
+    void ComputeNoiseBand(ColumnShapeParams& column) const;
+
+    /**
+     * @brief The single block a Z section [minZ, maxZ] of the chunk consists of, if the column terms decide it
+     *
+     * Requires every column's noise band to miss the section. Column shaping is affine in Z, so a column
+     * whose density has the same sign (with a margin for rounding) at both ends has it throughout.
+     *
+     * @return stone, sea or air staging ID, or STAGING_NO_BLOCK if the section needs per-voxel evaluation
+     */
+    uint16_t ClassifySection(const std::vector<ColumnShapeParams>& columnShape, int minZ, int maxZ,
+                             uint16_t stoneStagingId, uint16_t seaStagingId, uint16_t airStagingId) const;
+
+    /**
+     * @brief Combine raw 3D density noise with the column's bias, height offset, squashing and erosion terms
+     * @param column Cached column parameters from EvaluateColumnShape()
+     * @param densityNoise Raw 3D density noise at (x, y, globalZ)
+     * @param globalZ World Z coordinate (height)
+     * @return Final density value (< 0.0f = solid, >= 0.0f = air)
+     */
+    float ApplyColumnShaping(const ColumnShapeParams& column, float densityNoise, int globalZ) const;
+
+    /**
+     * @brief Sample the raw 3D density noise on the noise cell lattice covering a chunk
+     * @param chunkX Chunk X coordinate
+     * @param chunkY Chunk Y coordinate
+     * @param minZ Lowest voxel Z that will be interpolated (lattice layers below it are left at 0)
+     * @param maxZ Highest voxel Z that will be interpolated
+     * @param outLattice Lattice to fill (resized as needed)
+     */
+    void BuildNoiseLattice(int32_t chunkX, int32_t chunkY, int minZ, int maxZ, NoiseLattice& outLattice) const;
+
+    /**
+     * @brief Trilinearly interpolate the density noise of a voxel from a prebuilt lattice
+     * @note The voxel must lie inside the chunk the lattice was built for
+     */
+    float SampleNoiseLattice(const NoiseLattice& lattice, int globalX, int globalY, int globalZ) const;
+
+    /**
+     * @brief Interpolated density noise at a single voxel (noise cell mode, no lattice)
+     *
+     * Samples the 8 surrounding lattice corners directly. Bit-identical to
+     * SampleNoiseLattice() so ground height queries agree with generated chunks.
+     */
+    float SampleNoise3DCell(int globalX, int globalY, int globalZ) const;
+
+    /**
+     * @brief Raw density noise at a voxel, honouring the configured noise cell mode
+     */
+    float SampleDensityNoise(int globalX, int globalY, int globalZ) const;
+
+    /**
+     * @brief Noise cell comparison mode: evaluate exact density for a chunk and log sign mismatches / timing
+     * @param columnShape Per-column parameters of the chunk
+     * @param lattice Lattice built for the chunk
+     * @param latticeMicros Time spent building the lattice
+     */
+    void CompareNoiseCells(int32_t chunkX, int32_t chunkY, const std::vector<ColumnShapeParams>& columnShape,
+                           const NoiseLattice& lattice, uint64_t latticeMicros);
+
+    /**
+     * @brief Tree placement comparison mode: enumerate a chunk's tree sites in both placement modes
+     *        and log site counts / timing
+     */
+    void CompareTreePlacement(SimpleMinerTreeGenerator& treeGenerator, int32_t chunkX, int32_t chunkY);
+
     /**
      * @brief Calculate final terrain density at specific position
      *
@@ -330,6 +675,148 @@ private:
      */
     std::shared_ptr<enigma::registry::block::Block> GetCachedBlockById(int blockId) const;
 
+    /**
+     * @brief Get the default block state of a numeric block ID (flat table, registry fallback)
+     */
+    enigma::voxel::BlockState* GetCachedDefaultState(int blockId) const;
+
+    /**
+     * @brief This thread's generation scratch buffers
+     */
+    static GenerationScratch& GetThreadScratch();
+
+    /**
+     * @brief This worker's tree generator for this generator and seed (created on first use)
+     */
+    SimpleMinerTreeGenerator& AcquireTreeGenerator(GenerationScratch& scratch, uint32_t seed) const;
+
+    /**
+     * @brief Numeric block ID as stored in the staging buffer (STAGING_NO_BLOCK if not representable)
+     */
+    static uint16_t ToStagingId(int blockId);
+
+    /**
+     * @brief Copy the chunk's current block IDs into a staging buffer
+     */
+    void LoadChunkIntoStaging(Chunk* chunk, uint16_t* blockIds) const;
+
+    /**
+     * @brief Write a staging buffer into the chunk in one pass
+     * @param cancelToken Polled once per section of Z layers (nullptr = never cancel)
+     * @return false if generation was cancelled
+     */
+    bool CommitStagingToChunk(Chunk* chunk, const uint16_t* blockIds, ChunkGenerationToken* cancelToken) const;
+
+    /**
+     * @brief Run the pipeline stages after proto.status up to target, timing each one
+     *
+     * Polls the cancel token before every stage. On abort the chunk leaves the status map and
+     * feature writes it had claimed are handed back to the store.
+     *
+     * @return false if a stage was cancelled
+     */
+    bool AdvanceProtoChunk(ProtoChunk& proto, ProtoChunkStatus target);
+
+    bool RunStage(ProtoChunk& proto, ProtoChunkStatus stage);
+
+    /**
+     * @brief Climate stage: column shape parameters and noise bands from the climate tile, the tree
+     *        generator and the biome map (chunk plus tree placement border)
+     */
+    bool RunClimateStage(ProtoChunk& proto);
+
+    /**
+     * @brief Shape stage: 3D density into stone / air / water staging and the surface heightmap
+     */
+    bool RunShapeStage(ProtoChunk& proto);
+
+    /**
+     * @brief Surface stage: biome surface rules on the staging buffer
+     */
+    bool RunSurfaceStage(ProtoChunk& proto);
+
+    /**
+     * @brief Features stage: trees (including neighbours' trees clipped to the chunk), caves and ore veins
+     */
+    bool RunFeatureStage(ProtoChunk& proto);
+
+    /**
+     * @brief Full stage: commit the staging buffer, publish the heightmap and mark the chunk generated
+     */
+    bool RunCommitStage(ProtoChunk& proto);
+
+    /**
+     * @brief Add a completed stage's cost to the totals
+     * @return Number of chunks that have completed the stage, this one included
+     */
+    uint64_t RecordStageTime(ProtoChunkStatus stage, uint64_t micros);
+
+    /**
+     * @brief Log the average cost of every stage and the chunks currently in each stage
+     */
+    void LogStageTimings() const;
+
+    /**
+     * @brief Log a cancelled generation and return false (GenerateChunk's abort path)
+     */
+    bool AbortGeneration(int32_t chunkX, int32_t chunkY, const char* stage) const;
+
+    /**
+     * @brief Coal / iron / gold / diamond veins in a staging buffer (replace stone only)
+     *
+     * Vein origins and walks come from FeatureRandom streams of (seed, chunk, ore, vein), so the
+     * result does not depend on threads or generation order and needs no noise sampling.
+     */
+    void PlaceOreVeins(uint16_t* blockIds, int32_t chunkX, int32_t chunkY, uint32_t seed) const;
+
+    /**
+     * @brief Carve cheese and spaghetti caves into a staging buffer, flooding the deepest ones with lava
+     *
+     * Cave noise is sampled on a coarse lattice (CAVE_CELL_XY x CAVE_CELL_XY x CAVE_CELL_Z) and
+     * interpolated, and only for the solid voxels below surfaceHeight minus a roof: air, water and
+     * the sky above the terrain never cost a noise sample.
+     */
+    void CarveCaves(uint16_t* blockIds, const int* surfaceHeight, int32_t chunkX, int32_t chunkY, std::vector<float>& lattice) const;
+
+    /**
+     * @brief Topmost non-air, non-water Z of every column of a staging buffer (-1 = none)
+     */
+    void BuildSurfaceHeightmap(const uint16_t* blockIds, int* surfaceHeight) const;
+
+    /**
+     * @brief Phase 5: Surface rules applied to a staging buffer (used by GenerateChunk)
+     * @param surfaceHeight Per-column surface Z ([y][x]) from the terrain pass
+     * @param biomeMap Biomes covering at least this chunk's columns
+     */
+    void ApplySurfaceRulesToStaging(uint16_t* blockIds, const int* surfaceHeight, const BiomeMap& biomeMap,
+                                    int32_t   chunkX, int32_t         chunkY) const;
+
+    /**
+     * @brief Biome of one column from its five climate parameters (category classification + m_biomeTable)
+     */
+    BiomeId SelectBiome(float T, float H, float C, float E, float PV) const;
+
+    /**
+     * @brief Sample the five climate noises for every column of a tile (no caching)
+     */
+    std::shared_ptr<const ClimateTile> ComputeClimateTile(int tileX, int tileY) const;
+
+    /**
+     * @brief Topmost solid Z of a column by top-down scan (-1 = none)
+     * @param exact Sample the 3D noise inside the height band (false = noise 0 everywhere, an estimate)
+     */
+    int ScanSurfaceHeight(const ColumnShapeParams& column, int globalX, int globalY, bool exact) const;
+
+    /**
+     * @brief Exact topmost solid Z of one column; equals the generated chunk's heightmap
+     */
+    int ComputeExactSurfaceHeight(int globalX, int globalY) const;
+
+    /**
+     * @brief Noise-free surface estimate for every column of a tile (HeightmapService estimator)
+     */
+    void EstimateSurfaceTile(int32_t tileX, int32_t tileY, int16_t* outHeights) const;
+
     /**
      * @brief Compute 2D Perlin noise (legacy compatibility)
      */
@@ -368,7 +855,7 @@ private:
     bool ApplySurfaceRules(Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
 
     /**
-     * @brief Phase 7-9: Generate features (ores, caves, trees)
+     * @brief Phase 7-9: Generate features on an existing chunk (ore veins; trees only run inside GenerateChunk)
      */
     bool GenerateFeatures(Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
 
@@ -383,8 +870,9 @@ public:
     /**
      * @brief Constructor
      * @param worldSeed Seed for world generation
+     * @param config World generation tuning parameters (settings.yml "worldgen" section)
      */
-    explicit SimpleMinerGenerator(uint32_t worldSeed = 0);
+    explicit SimpleMinerGenerator(uint32_t worldSeed = 0, const WorldGenConfig& config = WorldGenConfig());
 
     /**
      * @brief Destructor
@@ -401,6 +889,76 @@ public:
      */
     bool GenerateChunk(Chunk* chunk, int32_t chunkX, int32_t chunkY, uint32_t worldSeed = 0) override;
 
+    /**
+     * @brief Cancel every chunk generation currently in flight
+     *
+     * Chunks that leave ChunkState::Generating are cancelled on their own; this is for callers
+     * that want all workers to stop early (e.g. world shutdown). Running GenerateChunk calls
+     * return false at their next stage boundary; calls started afterwards are unaffected.
+     */
+    void CancelPendingGeneration();
+
+    /**
+     * @brief Run the generation pipeline for a chunk without committing it (distant-chunk LOD, tools)
+     *
+     * Stops after target, which is capped at Features: only GenerateChunk commits. Detached runs
+     * do not publish their heights, so their result depends only on (seed, chunk).
+     * Uses this thread's scratch buffers and the constructor seed.
+     *
+     * @param outSurfaceHeight Topmost solid Z per column ([y][x], -1 = none), may be nullptr
+     * @param outSurfaceBlockIds Numeric block ID at that Z per column (0xFFFF = none), may be nullptr
+     * @return false if cancelled (CancelPendingGeneration)
+     */
+    bool GenerateProtoChunk(int32_t chunkX, int32_t chunkY, ProtoChunkStatus target, int* outSurfaceHeight, uint16_t* outSurfaceBlockIds);
+
+    // FNV-1a parameters of chunk content hashes (HashStagedBlocks) and of hashes combined over a region
+    static constexpr uint64_t CONTENT_HASH_OFFSET = 0xCBF29CE484222325ull;
+    static constexpr uint64_t CONTENT_HASH_PRIME  = 0x100000001B3ull;
+
+    /**
+     * @brief Content hash of a chunk's staged / committed block IDs (FNV-1a)
+     *
+     * Shared by benchmark and verification runs so their hashes stay comparable.
+     */
+    static uint64_t HashStagedBlocks(const std::vector<uint16_t>& blockIds);
+
+    /**
+     * @brief Detached run up to Features, hashed (HashStagedBlocks)
+     *
+     * Benchmarks and determinism checks: the hash only depends on the seed, the chunk and the
+     * generator configuration, never on threads or generation order.
+     * @return false if cancelled (CancelPendingGeneration)
+     */
+    bool GenerateDetachedChunkHash(int32_t chunkX, int32_t chunkY, uint64_t& outContentHash);
+
+    /**
+     * @brief Generate a region the way the world does, into memory, and hash every chunk (determinism checks)
+     *
+     * Runs GenerateChunk's pipeline on threadCount std::threads (chunks taken in list order) with
+     * the commit going to a buffer instead of a Chunk: exact heights are published as in the world, so
+     * border trees of later chunks read them instead of scanning density. Use a fresh generator per
+     * call: the heightmap cache carries over between calls.
+     *
+     * @param outContentHashes HashStagedBlocks of each chunk's committed block IDs, same order as chunks
+     * @return false if cancelled (CancelPendingGeneration)
+     */
+    bool GenerateRegionHashes(const std::vector<IntVec2>& chunks, int threadCount, std::vector<uint64_t>& outContentHashes);
+
+    /**
+     * @brief Total time and completed count per pipeline stage since construction (indexed by ToStageIndex)
+     */
+    void GetStageTotals(uint64_t (&outMicros)[PROTO_CHUNK_STAGE_COUNT], uint64_t (&outCounts)[PROTO_CHUNK_STAGE_COUNT]) const;
+
+    /**
+     * @brief Total time of each Features step since construction (per chunk: divide by the Features stage count)
+     */
+    void GetFeatureStepTotals(uint64_t (&outMicros)[FEATURE_STEP_COUNT]) const;
+
+    /**
+     * @brief Pipeline stage a chunk is in (Empty when not being generated, including finished chunks)
+     */
+    ProtoChunkStatus GetProtoChunkStatus(int32_t chunkX, int32_t chunkY) const;
+
     /**
      * @brief Get generator configuration description
      * @return String describing this generator's configuration
@@ -408,13 +966,12 @@ public:
     std::string GetConfigDescription() const override;
 
     /**
-     * @brief Get ground height at specific world position using noise calculation
+     * @brief Get ground height at specific world position through the heightmap service
      * 
-     * This method calculates the ground height at a given (x, y) position by sampling
-     * the 3D density noise without accessing chunk data. It uses binary search to find
-     * the highest solid block (density < 0.0f) efficiently.
+     * Exact for columns of chunks this generator has already generated, otherwise a cached
+     * analytic estimate from the column terms (3D noise treated as 0). Never evaluates 3D noise.
      * 
-     * Thread-safe: Does not access chunk data, only uses noise calculations.
+     * Thread-safe: Does not access chunk data.
      * 
      * @param globalX World X coordinate
      * @param globalY World Y coordinate (Z in Minecraft terms)
@@ -422,6 +979,14 @@ public:
      */
     int GetGroundHeightAt(int globalX, int globalY) const override;
 
+    /**
+     * @brief Exact topmost solid Z of a column (-1 = none), independent of generation order
+     *
+     * Uses the generated chunk's heightmap when available, otherwise scans the column's
+     * density. Used where neighbouring chunks must agree (trees crossing chunk borders).
+     */
+    int GetExactSurfaceHeight(int globalX, int globalY) const;
+
     /**
      * @brief Get biome at specific world position
      * 
@@ -432,7 +997,27 @@ public:
      * 
      * @param globalX World X coordinate
      * @param globalY World Y coordinate (Z in Minecraft terms)
-     * @return Biome instance for this location
+     * @return Biome at this location (GetBiome() for its instance)
+     */
+    BiomeId GetBiomeAt(int globalX, int globalY) const;
+
+    /**
+     * @brief Biome instance of an ID (owned by the generator), nullptr for BiomeId::Count
+     */
+    const enigma::voxel::Biome* GetBiome(BiomeId id) const
+    {
+        return id < BiomeId::Count ? m_biomes[ToIndex(id)].get() : nullptr;
+    }
+
+    /**
+     * @brief Fill a biome map for the inclusive world rectangle [minX, maxX] x [minY, maxY]
+     *
+     * Samples the climate noises row by row; every entry equals GetBiomeAt() for that column.
+     */
+    void BuildBiomeMap(int minX, int minY, int maxX, int maxY, BiomeMap& outMap) const;
+
+    /**
+     * @brief Climate noises of chunk-aligned tile (tileX, tileY), from the shared cache when enabled
      */
-    std::shared_ptr<enigma::voxel::Biome> GetBiomeAt(int globalX, int globalY) const;
+    std::shared_ptr<const ClimateTile> GetClimateTile(int tileX, int tileY) const;
 };
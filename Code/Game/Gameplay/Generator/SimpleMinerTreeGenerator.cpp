@@ -1,305 +1,157 @@
 ﻿#include "SimpleMinerTreeGenerator.hpp"
 #include "SimpleMinerGenerator.hpp"
-#include "../TreeStamps/OakTreeStamp.hpp"
-#include "../TreeStamps/OakSnowTreeStamp.hpp"
-#include "../TreeStamps/BirchTreeStamp.hpp"
-#include "../TreeStamps/SpruceTreeStamp.hpp"
-#include "../TreeStamps/SpruceSnowTreeStamp.hpp"
-#include "../TreeStamps/JungleTreeStamp.hpp"
-#include "../TreeStamps/AcaciaTreeStamp.hpp"
+#include "ChunkCoords.hpp"
 #include "Engine/Core/Logger/LoggerAPI.hpp"
 #include "Engine/Voxel/Chunk/Chunk.hpp"
 #include "Engine/Registry/Block/BlockRegistry.hpp"
 #include "Engine/Math/IntVec3.hpp"
-#include "Engine/Voxel/Biome/Biome.hpp"
 #include <algorithm>
+#include <string>
+
+namespace
+{
+    // Independent hash streams of a placement grid cell
+    enum TreeCellChannel : uint32_t
+    {
+        CELL_JITTER_X = 0,
+        CELL_JITTER_Y,
+        CELL_ACCEPT,
+        CELL_SIZE
+    };
+
+    // SquirrelNoise5 style position hash: same cell, seed and channel -> same value in every chunk
+    uint32_t HashTreeCell(int cellX, int cellY, uint32_t seed, uint32_t channel)
+    {
+        constexpr uint32_t BIT_NOISE1 = 0xD2A80A3Fu;
+        constexpr uint32_t BIT_NOISE2 = 0xA884F197u;
+        constexpr uint32_t BIT_NOISE3 = 0x6C736F4Bu;
+        constexpr uint32_t BIT_NOISE4 = 0xB79F3ABBu;
+        constexpr uint32_t BIT_NOISE5 = 0x1B56C4F5u;
+
+        uint32_t mangled = static_cast<uint32_t>(cellX) + 198491317u * static_cast<uint32_t>(cellY) + 6542989u * channel;
+        mangled *= BIT_NOISE1;
+        mangled += seed;
+        mangled ^= (mangled >> 9);
+        mangled += BIT_NOISE2;
+        mangled ^= (mangled >> 11);
+        mangled *= BIT_NOISE3;
+        mangled ^= (mangled >> 13);
+        mangled += BIT_NOISE4;
+        mangled ^= (mangled >> 15);
+        mangled *= BIT_NOISE5;
+        mangled ^= (mangled >> 17);
+        return mangled;
+    }
+
+    // [0, 1) from the top 24 bits
+    float HashTreeCellZeroToOne(int cellX, int cellY, uint32_t seed, uint32_t channel)
+    {
+        return static_cast<float>(HashTreeCell(cellX, cellY, seed, channel) >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Threshold used when a column has no biome (matches the original placement loop)
+    constexpr float NO_BIOME_TREE_THRESHOLD = 0.7f;
+
+    // Tree placement rules of one biome
+    struct BiomeTreeRule
+    {
+        float    threshold; // Minimum tree noise at a local maximum (1.0 = no trees)
+        TreeType belowSplit; // Tree type when rotation noise < split
+        TreeType aboveSplit; // Tree type otherwise (only type if both are equal)
+        float    split;
+    };
+
+    // Indexed by BiomeId
+    constexpr BiomeTreeRule BIOME_TREE_RULES[] = {
+        {1.0f, TreeType::Oak, TreeType::Oak, 0.0f}, // Ocean
+        {1.0f, TreeType::Oak, TreeType::Oak, 0.0f}, // DeepOcean
+        {1.0f, TreeType::Oak, TreeType::Oak, 0.0f}, // FrozenOcean
+        {1.0f, TreeType::Oak, TreeType::Oak, 0.0f}, // Beach
+        {1.0f, TreeType::Oak, TreeType::Oak, 0.0f}, // SnowyBeach
+        {0.999f, TreeType::Cactus, TreeType::Acacia, 0.7f}, // Desert: almost no trees
+        {0.94f, TreeType::Oak, TreeType::Oak, 0.0f}, // Savanna: sparse
+        {0.998f, TreeType::Birch, TreeType::Oak, 0.5f}, // Plains: nearly treeless
+        {0.998f, TreeType::OakSnow, TreeType::OakSnow, 0.0f}, // SnowyPlains
+        {0.82f, TreeType::Birch, TreeType::Oak, 0.5f}, // Forest
+        {0.78f, TreeType::Jungle, TreeType::Jungle, 0.0f}, // Jungle: dense
+        {0.88f, TreeType::Spruce, TreeType::Spruce, 0.0f}, // Taiga (its climate temperature -0.3 is never T0)
+        {0.88f, TreeType::SpruceSnow, TreeType::SpruceSnow, 0.0f}, // SnowyTaiga
+        {1.0f, TreeType::Oak, TreeType::Oak, 0.0f}, // StonyPeaks
+        {1.0f, TreeType::Oak, TreeType::Oak, 0.0f}, // SnowyPeaks
+    };
+    static_assert(sizeof(BIOME_TREE_RULES) / sizeof(BIOME_TREE_RULES[0]) == BIOME_COUNT, "One tree rule per BiomeId");
+}
 
 SimpleMinerTreeGenerator::SimpleMinerTreeGenerator(uint32_t                    worldSeed, const TerrainGenerator* terrainGenerator,
-                                                   const SimpleMinerGenerator* simpleMinerGenerator)
+                                                   const SimpleMinerGenerator* simpleMinerGenerator, const TreeStampLibrary* stampLibrary)
     : TreeGenerator(worldSeed, terrainGenerator)
+      , m_stampLibrary(stampLibrary)
       , m_simpleMinerGenerator(simpleMinerGenerator)
+      , m_placementSeed(worldSeed)
 {
-    InitializeStampCache();
 }
 
-void SimpleMinerTreeGenerator::InitializeStampCache()
+void SimpleMinerTreeGenerator::SetPlacementMode(TreePlacementMode mode, int gridCellSize)
 {
-    // Initialize all tree stamp types
-    m_stampCache["oak"]         = std::make_shared<OakTreeStamp>();
-    m_stampCache["oak_snow"]    = std::make_shared<OakSnowTreeStamp>();
-    m_stampCache["birch"]       = std::make_shared<BirchTreeStamp>();
-    m_stampCache["spruce"]      = std::make_shared<SpruceTreeStamp>();
-    m_stampCache["spruce_snow"] = std::make_shared<SpruceSnowTreeStamp>();
-    m_stampCache["jungle"]      = std::make_shared<JungleTreeStamp>();
-    m_stampCache["acacia"]      = std::make_shared<AcaciaTreeStamp>();
-    m_stampCache["cactus"]      = std::make_shared<CactusStamp>();
-
-    LogInfo("TreeGenerator", "Initialized %zu tree stamp types", m_stampCache.size());
+    m_placementMode = mode;
+    m_gridCellSize  = (std::max)(gridCellSize, 3);
 }
 
-std::shared_ptr<TreeStamp> SimpleMinerTreeGenerator::GetTreeStamp(const std::string& typeName) const
+TreeType SimpleMinerTreeGenerator::SelectTreeType(BiomeId biome, int globalX, int globalY) const
 {
-    auto it = m_stampCache.find(typeName);
-    if (it != m_stampCache.end())
-    {
-        return it->second;
-    }
-    return nullptr;
-}
-
-std::string SimpleMinerTreeGenerator::SelectTreeType(const enigma::voxel::Biome* biome, int globalX, int globalY) const
-{
-    if (!biome)
-    {
-        return "oak"; // Default fallback
-    }
-
-    std::string biomeName = biome->GetName();
-
-    // Desert biome -> Cactus (70%) or Acacia trees (30%)
-    if (biomeName.find("desert") != std::string::npos)
-    {
-        // Use rotation noise to determine cactus vs acacia
-        float random = SampleTreeRotationNoise(globalX, globalY);
-        return (random < 0.7f) ? "cactus" : "acacia";
-    }
-    // Jungle biome -> Jungle trees
-    else if (biomeName.find("jungle") != std::string::npos)
+    if (biome >= BiomeId::Count)
     {
-        return "jungle";
+        return TreeType::Oak; // Default fallback
     }
-    // Taiga biomes -> Spruce trees (with snow variant for cold regions)
-    else if (biomeName.find("taiga") != std::string::npos)
-    {
-        // Check if this is a snowy taiga biome
-        if (biomeName.find("snowy") != std::string::npos)
-        {
-            return "spruce_snow";
-        }
-
-        // For regular taiga in T0 (very cold) regions, also use spruce_snow
-        // T0 category: temperature < -0.45
-        if (m_simpleMinerGenerator)
-        {
-            auto biomeAt = m_simpleMinerGenerator->GetBiomeAt(globalX, globalY);
-            if (biomeAt)
-            {
-                float temperature = biomeAt->GetClimateSettings().temperature;
-                if (temperature < -0.45f)
-                {
-                    return "spruce_snow";
-                }
-            }
-        }
 
-        return "spruce";
-    }
-    // Forest biome -> Oak or Birch (random based on rotation noise)
-    else if (biomeName.find("forest") != std::string::npos)
-    {
-        float random = SampleTreeRotationNoise(globalX, globalY);
-        return (random > 0.5f) ? "oak" : "birch";
-    }
-    // Plains biome -> Oak or Birch (with snowy variant for cold regions)
-    else if (biomeName.find("plains") != std::string::npos)
+    // Two-type biomes pick by rotation noise (desert: cactus 70% / acacia 30%, forest and plains: birch / oak)
+    const BiomeTreeRule& rule = BIOME_TREE_RULES[ToIndex(biome)];
+    if (rule.belowSplit == rule.aboveSplit)
     {
-        // Check if this is a snowy plains biome
-        if (biomeName.find("snowy") != std::string::npos)
-        {
-            return "oak_snow"; // Snowy plains -> Oak with snow
-        }
-        float random = SampleTreeRotationNoise(globalX, globalY);
-        return (random > 0.5f) ? "oak" : "birch";
-    }
-    // Default -> Oak
-    else
-    {
-        return "oak";
+        return rule.aboveSplit;
     }
+    float random = SampleTreeRotationNoise(globalX, globalY);
+    return (random < rule.split) ? rule.belowSplit : rule.aboveSplit;
 }
 
-std::string SimpleMinerTreeGenerator::SelectTreeSize(float noiseValue) const
+TreeSize SimpleMinerTreeGenerator::SelectTreeSize(float noiseValue) const
 {
     if (noiseValue >= 0.95f)
     {
-        return "large";
+        return TreeSize::Large;
     }
     else if (noiseValue >= 0.85f)
     {
-        return "medium";
+        return TreeSize::Medium;
     }
     else
     {
-        return "small";
+        return TreeSize::Small;
     }
 }
 
-float SimpleMinerTreeGenerator::GetTreeThreshold(const enigma::voxel::Biome* biome) const
+float SimpleMinerTreeGenerator::GetTreeThreshold(BiomeId biome) const
 {
-    if (!biome)
-    {
-        return 0.92f; // Default threshold (increased from 0.85)
-    }
-
-    std::string biomeName = biome->GetName();
-
-    // Forest biome -> Lower threshold (more trees)
-    if (biomeName.find("forest") != std::string::npos)
-    {
-        return 0.82f; // Increased from 0.7 to reduce density
-    }
-    // Plains biome -> Very high threshold (almost no trees)
-    else if (biomeName.find("plains") != std::string::npos)
-    {
-        return 0.998f; // Increased from 0.95 to make plains nearly treeless
-    }
-    // Desert biome -> Extremely high threshold (almost no trees)
-    else if (biomeName.find("desert") != std::string::npos)
-    {
-        return 0.999f; // Increased from 0.98 for even fewer trees
-    }
-    // Taiga biomes -> Medium-high threshold
-    else if (biomeName.find("taiga") != std::string::npos)
-    {
-        return 0.88f; // New: specific threshold for taiga biomes
-    }
-    // Jungle biomes -> Lower threshold (dense trees)
-    else if (biomeName.find("jungle") != std::string::npos)
-    {
-        return 0.78f; // New: specific threshold for jungle biomes (high density)
-    }
-    // Savanna biomes -> High threshold (sparse trees)
-    else if (biomeName.find("savanna") != std::string::npos)
+    if (biome >= BiomeId::Count)
     {
-        return 0.94f; // New: specific threshold for savanna biomes
-    }
-    // Default threshold (for other biomes)
-    else
-    {
-        return 1.0; // Increased from 0.85 to reduce overall density
+        return NO_BIOME_TREE_THRESHOLD;
     }
+    return BIOME_TREE_RULES[ToIndex(biome)].threshold;
 }
 
-std::shared_ptr<TreeStamp> SimpleMinerTreeGenerator::GetOrCreateStamp(const std::string& treeType, const std::string& treeSize)
+float SimpleMinerTreeGenerator::GetTreeAcceptance(float treeThreshold) const
 {
-    // Create cache key: "type_size" (e.g., "oak_small")
-    std::string cacheKey = treeType + "_" + treeSize;
-
-    // Check if stamp is already in cache
-    auto it = m_stampCache.find(cacheKey);
-    if (it != m_stampCache.end())
-    {
-        return it->second;
-    }
-
-    // Create new stamp using factory methods
-    std::shared_ptr<TreeStamp> newStamp = nullptr;
-
-    // Convert size to lowercase for comparison
-    std::string sizeLower = treeSize;
-    std::transform(sizeLower.begin(), sizeLower.end(), sizeLower.begin(), [](unsigned char c) -> char
-    {
-        return static_cast<char>(std::tolower(c));
-    });
-
-    // Create stamp based on type and size
-    if (treeType == "oak")
-    {
-        if (sizeLower == "small")
-            newStamp = std::make_shared<OakTreeStamp>(OakTreeStamp::CreateSmall());
-        else if (sizeLower == "medium")
-            newStamp = std::make_shared<OakTreeStamp>(OakTreeStamp::CreateMedium());
-        else if (sizeLower == "large")
-            newStamp = std::make_shared<OakTreeStamp>(OakTreeStamp::CreateLarge());
-    }
-    else if (treeType == "oak_snow")
-    {
-        if (sizeLower == "small")
-            newStamp = std::make_shared<OakSnowTreeStamp>(OakSnowTreeStamp::CreateSmall());
-        else if (sizeLower == "medium")
-            newStamp = std::make_shared<OakSnowTreeStamp>(OakSnowTreeStamp::CreateMedium());
-        else if (sizeLower == "large")
-            newStamp = std::make_shared<OakSnowTreeStamp>(OakSnowTreeStamp::CreateLarge());
-    }
-    else if (treeType == "birch")
-    {
-        if (sizeLower == "small")
-            newStamp = std::make_shared<BirchTreeStamp>(BirchTreeStamp::CreateSmall());
-        else if (sizeLower == "medium")
-            newStamp = std::make_shared<BirchTreeStamp>(BirchTreeStamp::CreateMedium());
-        else if (sizeLower == "large")
-            newStamp = std::make_shared<BirchTreeStamp>(BirchTreeStamp::CreateLarge());
-    }
-    else if (treeType == "spruce")
-    {
-        if (sizeLower == "small")
-            newStamp = std::make_shared<SpruceTreeStamp>(SpruceTreeStamp::CreateSmall());
-        else if (sizeLower == "medium")
-            newStamp = std::make_shared<SpruceTreeStamp>(SpruceTreeStamp::CreateMedium());
-        else if (sizeLower == "large")
-            newStamp = std::make_shared<SpruceTreeStamp>(SpruceTreeStamp::CreateLarge());
-    }
-    else if (treeType == "spruce_snow")
-    {
-        if (sizeLower == "small")
-            newStamp = std::make_shared<SpruceSnowTreeStamp>(SpruceSnowTreeStamp::CreateSmall());
-        else if (sizeLower == "medium")
-            newStamp = std::make_shared<SpruceSnowTreeStamp>(SpruceSnowTreeStamp::CreateMedium());
-        else if (sizeLower == "large")
-            newStamp = std::make_shared<SpruceSnowTreeStamp>(SpruceSnowTreeStamp::CreateLarge());
-    }
-    else if (treeType == "jungle")
-    {
-        if (sizeLower == "small")
-            newStamp = std::make_shared<JungleTreeStamp>(JungleTreeStamp::CreateSmall());
-        else if (sizeLower == "medium")
-            newStamp = std::make_shared<JungleTreeStamp>(JungleTreeStamp::CreateMedium());
-        else if (sizeLower == "large")
-            newStamp = std::make_shared<JungleTreeStamp>(JungleTreeStamp::CreateLarge());
-    }
-    else if (treeType == "acacia")
-    {
-        if (sizeLower == "small")
-            newStamp = std::make_shared<AcaciaTreeStamp>(AcaciaTreeStamp::CreateSmall());
-        else if (sizeLower == "medium")
-            newStamp = std::make_shared<AcaciaTreeStamp>(AcaciaTreeStamp::CreateMedium());
-        else if (sizeLower == "large")
-            newStamp = std::make_shared<AcaciaTreeStamp>(AcaciaTreeStamp::CreateLarge());
-    }
-    else if (treeType == "cactus")
-    {
-        if (sizeLower == "small")
-            newStamp = std::make_shared<CactusStamp>(CactusStamp::CreateSmall());
-        else if (sizeLower == "medium")
-            newStamp = std::make_shared<CactusStamp>(CactusStamp::CreateMedium());
-        else if (sizeLower == "large")
-            newStamp = std::make_shared<CactusStamp>(CactusStamp::CreateLarge());
-    }
-
-    // If stamp was created, add to cache
-    if (newStamp)
-    {
-        m_stampCache[cacheKey] = newStamp;
-        LogDebug("TreeGenerator", "Created and cached tree stamp: %s", cacheKey.c_str());
-    }
-    else
-    {
-        LogWarn("TreeGenerator", "Failed to create tree stamp for type=%s, size=%s", treeType.c_str(), treeSize.c_str());
-    }
-
-    return newStamp;
+    constexpr float FULL_DENSITY_THRESHOLD = 0.78f; // Jungle
+    float           acceptance             = (1.0f - treeThreshold) / (1.0f - FULL_DENSITY_THRESHOLD);
+    return (std::min)((std::max)(acceptance, 0.0f), 1.0f);
 }
 
-std::string SimpleMinerTreeGenerator::DetermineTreeType(int globalX, int globalY) const
+TreeType SimpleMinerTreeGenerator::DetermineTreeType(BiomeId biome, int globalX, int globalY) const
 {
-    // Get biome at this position using SimpleMinerGenerator
-    if (m_simpleMinerGenerator)
+    // Biome-based selection
+    if (biome < BiomeId::Count)
     {
-        auto biome = m_simpleMinerGenerator->GetBiomeAt(globalX, globalY);
-        if (biome)
-        {
-            return SelectTreeType(biome.get(), globalX, globalY);
-        }
+        return SelectTreeType(biome, globalX, globalY);
     }
 
     // Fallback: use noise-based selection if biome is not available
@@ -307,15 +159,15 @@ std::string SimpleMinerTreeGenerator::DetermineTreeType(int globalX, int globalY
 
     // Simple distribution based on noise value
     if (sizeNoise < 0.2f)
-        return "oak";
+        return TreeType::Oak;
     else if (sizeNoise < 0.4f)
-        return "birch";
+        return TreeType::Birch;
     else if (sizeNoise < 0.6f)
-        return "spruce";
+        return TreeType::Spruce;
     else if (sizeNoise < 0.8f)
-        return "jungle";
+        return TreeType::Jungle;
     else
-        return "acacia";
+        return TreeType::Acacia;
 }
 
 bool SimpleMinerTreeGenerator::CanPlaceTree(int globalX, int globalY, int groundHeight, int treeHeight) const
@@ -346,114 +198,96 @@ bool SimpleMinerTreeGenerator::CanPlaceTree(int globalX, int globalY, int ground
     return true;
 }
 
-bool SimpleMinerTreeGenerator::PlaceTree(Chunk* chunk, int32_t chunkX, int32_t           chunkY,
-                                         int    globalX, int   globalY, const TreeStamp& stamp)
+void SimpleMinerTreeGenerator::GetPlacementBounds(int32_t chunkX, int32_t chunkY, int& minX, int& maxX, int& minY, int& maxY) const
 {
-    if (!chunk)
+    // GenerateTrees iterates [expandedMin, expandedMax)
+    CalculateExpandedBounds(chunkX, chunkY, minX, maxX, minY, maxY);
+    maxX -= 1;
+    maxY -= 1;
+}
+
+BiomeId SimpleMinerTreeGenerator::LookupBiome(int globalX, int globalY) const
+{
+    if (m_biomeMap && m_biomeMap->Contains(globalX, globalY))
     {
-        LogError("TreeGenerator", "PlaceTree - null chunk provided");
-        return false;
+        return m_biomeMap->Get(globalX, globalY);
+    }
+    if (m_simpleMinerGenerator)
+    {
+        return m_simpleMinerGenerator->GetBiomeAt(globalX, globalY);
     }
+    return BiomeId::Count;
+}
 
-    // Get ground height at tree origin using terrain generator
-    int groundZ = GetGroundHeightAt(globalX, globalY);
+int SimpleMinerTreeGenerator::GetTreeGroundHeight(int32_t chunkX, int32_t chunkY, int globalX, int globalY, const CompiledTreeStamp& stamp) const
+{
+    int chunkMinX = chunkX * Chunk::CHUNK_SIZE_X;
+    int chunkMinY = chunkY * Chunk::CHUNK_SIZE_Y;
+    if (m_surfaceHeight &&
+        stamp.InsideColumns(globalX, globalY, chunkMinX, chunkMinX + Chunk::CHUNK_SIZE_X - 1, chunkMinY, chunkMinY + Chunk::CHUNK_SIZE_Y - 1) &&
+        globalX >= chunkMinX && globalX < chunkMinX + Chunk::CHUNK_SIZE_X && globalY >= chunkMinY && globalY < chunkMinY + Chunk::CHUNK_SIZE_Y)
+    {
+        return m_surfaceHeight[(globalY - chunkMinY) * Chunk::CHUNK_SIZE_X + (globalX - chunkMinX)];
+    }
+    if (m_simpleMinerGenerator)
+    {
+        // Same answer in every chunk regardless of which one generated first
+        return m_simpleMinerGenerator->GetExactSurfaceHeight(globalX, globalY);
+    }
+    return GetGroundHeightAt(globalX, globalY);
+}
 
+bool SimpleMinerTreeGenerator::PlaceTree(Chunk* chunk, uint16_t* stagingBlockIds, int32_t chunkX, int32_t chunkY,
+                                         int    globalX, int       globalY, int          groundZ, const CompiledTreeStamp& stamp)
+{
     // Validate ground height
-    if (groundZ < 0 || groundZ >= Chunk::CHUNK_SIZE_Z - stamp.GetHeight())
+    if (groundZ < 0 || groundZ >= Chunk::CHUNK_SIZE_Z - stamp.height)
     {
         return false;
     }
 
-    // Get all blocks from the tree stamp
-    const std::vector<TreeStampBlock>& blocks = stamp.GetBlocks();
+    // Tree origin relative to the chunk; blocks of the stamp outside the chunk are skipped and
+    // placed by every neighbour they reach, which evaluates the same tree and clips it to itself
+    int originX = globalX - chunkX * Chunk::CHUNK_SIZE_X;
+    int originY = globalY - chunkY * Chunk::CHUNK_SIZE_Y;
 
-    int blocksPlaced  = 0;
-    int blocksSkipped = 0;
-
-    // Iterate through all blocks in the tree stamp
-    for (const auto& stampBlock : blocks)
+    int blocksPlaced = 0;
+    for (const CompiledTreeStamp::Block& stampBlock : stamp.blocks)
     {
-        // Calculate global position of this block
-        IntVec3 globalPos(
-            globalX + stampBlock.offset.x,
-            globalY + stampBlock.offset.y,
-            groundZ + stampBlock.offset.z
-        );
-
-        // Convert global position to local chunk coordinates
-        int localX = globalPos.x - chunkX * Chunk::CHUNK_SIZE_X;
-        int localY = globalPos.y - chunkY * Chunk::CHUNK_SIZE_Y;
-        int localZ = globalPos.z;
-
-        // ========== KEY: Cross-Chunk Boundary Check ==========
-        // Only modify blocks within the current chunk
-        // Cross-chunk parts are automatically skipped
-        // This ensures thread safety and cross-chunk consistency
-        // Following Professor's principle (conversation-0.txt:138):
-        // "Chunk (5,6) can do all of the math and noise it needs to know 
-        //  even its neighbor Chunk's noise and tree placement without ever 
-        //  looking at or talking to the neighbor Chunk."
+        int localX = originX + stampBlock.offsetX;
+        int localY = originY + stampBlock.offsetY;
+        int localZ = groundZ + stampBlock.offsetZ;
         if (localX < 0 || localX >= Chunk::CHUNK_SIZE_X ||
             localY < 0 || localY >= Chunk::CHUNK_SIZE_Y ||
             localZ < 0 || localZ >= Chunk::CHUNK_SIZE_Z)
         {
-            // Block is outside current chunk, skip it
-            // Neighbor chunks will place their own parts independently
-            blocksSkipped++;
             continue;
         }
 
-        // Get block state from registry
-        // First get the Block from BlockRegistry, then get its default BlockState
-        auto block = enigma::registry::block::BlockRegistry::GetBlockById(stampBlock.blockId);
-        if (!block)
-        {
-            LogWarn("TreeGenerator", "Failed to get block for ID: %d", stampBlock.blockId);
-            continue;
-        }
-        auto* blockState = block->GetDefaultState();
-        if (!blockState)
+        // Never overwrite terrain (stone, ores, ...); where trees overlap the higher (rank, ID) wins
+        if (stagingBlockIds)
         {
-            LogWarn("TreeGenerator", "Failed to get block state for ID: %d", stampBlock.blockId);
-            continue;
+            uint16_t& stagedId = stagingBlockIds[(localZ * Chunk::CHUNK_SIZE_Y + localY) * Chunk::CHUNK_SIZE_X + localX];
+            if (!m_stampLibrary->CanPlace(stagedId, stampBlock.blockId))
+            {
+                continue;
+            }
+            stagedId = stampBlock.blockId;
         }
-
-        // Check if we should overwrite the existing block
-        auto* existingBlock = chunk->GetBlock(localX, localY, localZ);
-        if (existingBlock)
+        else
         {
-            int existingBlockId = existingBlock->GetBlock()->GetNumericId();
-            UNUSED(existingBlockId)
-            // Don't overwrite solid blocks (stone, ores, etc.)
-            // Only overwrite air, grass, leaves, and other replaceable blocks
-            // TODO: Use block properties to determine if block is replaceable
-            // For now, use a simple heuristic based on block ID
-
-            // Get block name to check if it's replaceable
-            std::string blockName = existingBlock->GetBlock()->GetRegistryName();
-
-            // Replaceable blocks: air, grass, leaves, water (for now)
-            bool isReplaceable = (blockName == "air" ||
-                blockName.find("grass") != std::string::npos ||
-                blockName.find("leaves") != std::string::npos ||
-                blockName == "water");
-
-            if (!isReplaceable)
+            auto* existingBlock = chunk->GetBlock(localX, localY, localZ);
+            auto* existingType  = existingBlock ? existingBlock->GetBlock() : nullptr;
+            auto  existingId    = existingType ? static_cast<uint16_t>(existingType->GetNumericId()) : TreeStampLibrary::NO_BLOCK_ID;
+            if (!m_stampLibrary->CanPlace(existingId, stampBlock.blockId))
             {
-                // Don't overwrite solid blocks
-                blocksSkipped++;
                 continue;
             }
+            chunk->SetBlock(localX, localY, localZ, stampBlock.state);
         }
-
-        // Place the block in the chunk
-        chunk->SetBlock(localX, localY, localZ, blockState);
         blocksPlaced++;
     }
 
-    LogDebug("TreeGenerator", "Placed tree at (%d, %d, %d): %d blocks placed, %d blocks skipped",
-             globalX, globalY, groundZ, blocksPlaced, blocksSkipped);
-
     return blocksPlaced > 0;
 }
 
@@ -464,24 +298,54 @@ bool SimpleMinerTreeGenerator::GenerateTrees(Chunk* chunk, int32_t chunkX, int32
         LogError("TreeGenerator", "GenerateTrees - null chunk provided");
         return false;
     }
+    PlaceTrees(chunk, nullptr, chunkX, chunkY);
+    return true;
+}
+
+bool SimpleMinerTreeGenerator::GenerateTreesInStaging(uint16_t* stagingBlockIds, int32_t chunkX, int32_t chunkY)
+{
+    if (!stagingBlockIds)
+    {
+        LogError("TreeGenerator", "GenerateTreesInStaging - null staging buffer provided");
+        return false;
+    }
+    PlaceTrees(nullptr, stagingBlockIds, chunkX, chunkY);
+    return true;
+}
 
-    // Clear noise cache for this chunk
-    ClearNoiseCache();
+int SimpleMinerTreeGenerator::CountTreeSites(int32_t chunkX, int32_t chunkY, TreePlacementMode mode)
+{
+    CollectTreeSites(chunkX, chunkY, mode);
+    return static_cast<int>(m_sites.size());
+}
 
-    // Calculate expanded chunk boundaries
-    int expandedMinX, expandedMaxX, expandedMinY, expandedMaxY;
-    CalculateExpandedBounds(chunkX, chunkY, expandedMinX, expandedMaxX, expandedMinY, expandedMaxY);
+void SimpleMinerTreeGenerator::CollectTreeSites(int32_t chunkX, int32_t chunkY, TreePlacementMode mode)
+{
+    // Origins to consider, as [min, max)
+    int originMinX, originMaxX, originMinY, originMaxY;
+    GetPlacementBounds(chunkX, chunkY, originMinX, originMaxX, originMinY, originMaxY);
+    originMaxX += 1;
+    originMaxY += 1;
 
-    int treesPlaced = 0;
+    // Clear noise cache for this chunk (tree type selection samples it in both modes)
+    ClearNoiseCache();
 
-    // Statistics for logging (tree type and size distribution)
-    std::unordered_map<std::string, int> treeTypeCount;
-    std::unordered_map<std::string, int> treeSizeCount;
+    m_sites.clear();
+    if (mode == TreePlacementMode::JitteredGrid)
+    {
+        CollectGridSites(originMinX, originMaxX, originMinY, originMaxY);
+    }
+    else
+    {
+        CollectNoiseMaximaSites(originMinX, originMaxX, originMinY, originMaxY);
+    }
+}
 
-    // Iterate through expanded area
-    for (int globalX = expandedMinX; globalX < expandedMaxX; globalX++)
+void SimpleMinerTreeGenerator::CollectNoiseMaximaSites(int minX, int maxX, int minY, int maxY)
+{
+    for (int globalX = minX; globalX < maxX; globalX++)
     {
-        for (int globalY = expandedMinY; globalY < expandedMaxY; globalY++)
+        for (int globalY = minY; globalY < maxY; globalY++)
         {
             // Sample tree noise at this position
             float treeNoise = SampleTreeNoise(globalX, globalY);
@@ -493,15 +357,8 @@ bool SimpleMinerTreeGenerator::GenerateTrees(Chunk* chunk, int32_t chunkX, int32
             }
 
             // Get biome at this position to determine tree threshold
-            float treeThreshold = 0.7f; // Default threshold
-            if (m_simpleMinerGenerator)
-            {
-                auto biome = m_simpleMinerGenerator->GetBiomeAt(globalX, globalY);
-                if (biome)
-                {
-                    treeThreshold = GetTreeThreshold(biome.get());
-                }
-            }
+            BiomeId biome         = LookupBiome(globalX, globalY);
+            float   treeThreshold = GetTreeThreshold(biome);
 
             // Check if noise value is above biome-specific threshold
             if (treeNoise < treeThreshold)
@@ -509,68 +366,120 @@ bool SimpleMinerTreeGenerator::GenerateTrees(Chunk* chunk, int32_t chunkX, int32
                 continue;
             }
 
-            // Get ground height at this position
-            int groundHeight = GetGroundHeightAt(globalX, globalY);
-
-            // Determine tree type based on biome
-            std::string treeType = DetermineTreeType(globalX, globalY);
+            m_sites.push_back({globalX, globalY, treeNoise, biome});
+        }
+    }
+}
 
-            // Select tree size based on noise value
-            std::string treeSize = SelectTreeSize(treeNoise);
+void SimpleMinerTreeGenerator::CollectGridSites(int minX, int maxX, int minY, int maxY)
+{
+    // Jitter within [0, cell - 2] so trunks of neighbouring cells are at least 2 blocks apart
+    const int jitterRange = m_gridCellSize - 1;
 
-            // Get or create tree stamp with type and size
-            auto treeStamp = GetOrCreateStamp(treeType, treeSize);
-            if (!treeStamp)
+    for (int cellX = FloorDivide(minX, m_gridCellSize); cellX <= FloorDivide(maxX - 1, m_gridCellSize); ++cellX)
+    {
+        for (int cellY = FloorDivide(minY, m_gridCellSize); cellY <= FloorDivide(maxY - 1, m_gridCellSize); ++cellY)
+        {
+            int globalX = cellX * m_gridCellSize + static_cast<int>(HashTreeCell(cellX, cellY, m_placementSeed, CELL_JITTER_X) % jitterRange);
+            int globalY = cellY * m_gridCellSize + static_cast<int>(HashTreeCell(cellX, cellY, m_placementSeed, CELL_JITTER_Y) % jitterRange);
+            if (globalX < minX || globalX >= maxX || globalY < minY || globalY >= maxY)
             {
-                LogWarn("TreeGenerator", "Failed to get tree stamp for type=%s, size=%s", treeType.c_str(), treeSize.c_str());
                 continue;
             }
 
-            // Get tree height from stamp
-            int treeHeight = treeStamp->GetHeight();
-
-            // Check if tree can be placed
-            if (!CanPlaceTree(globalX, globalY, groundHeight, treeHeight))
+            BiomeId biome         = LookupBiome(globalX, globalY);
+            float   treeThreshold = GetTreeThreshold(biome);
+            if (HashTreeCellZeroToOne(cellX, cellY, m_placementSeed, CELL_ACCEPT) >= GetTreeAcceptance(treeThreshold))
             {
                 continue;
             }
 
-            // Place tree using TreeStamp
-            if (PlaceTree(chunk, chunkX, chunkY, globalX, globalY, *treeStamp))
-            {
-                treesPlaced++;
+            // Stand-in for the tree noise of an accepted maximum: uniform over [threshold, 1]
+            float sizeValue = treeThreshold + (1.0f - treeThreshold) * HashTreeCellZeroToOne(cellX, cellY, m_placementSeed, CELL_SIZE);
+            m_sites.push_back({globalX, globalY, sizeValue, biome});
+        }
+    }
+}
 
-                // Update statistics
-                treeTypeCount[treeType]++;
-                treeSizeCount[treeSize]++;
-            }
+void SimpleMinerTreeGenerator::PlaceTrees(Chunk* chunk, uint16_t* stagingBlockIds, int32_t chunkX, int32_t chunkY)
+{
+    CollectTreeSites(chunkX, chunkY, m_placementMode);
+
+    int chunkMinX = chunkX * Chunk::CHUNK_SIZE_X;
+    int chunkMinY = chunkY * Chunk::CHUNK_SIZE_Y;
+    int chunkMaxX = chunkMinX + Chunk::CHUNK_SIZE_X - 1;
+    int chunkMaxY = chunkMinY + Chunk::CHUNK_SIZE_Y - 1;
+
+    int treesPlaced = 0;
+
+    // Statistics for logging (tree type and size distribution)
+    int treeTypeCount[TreeStampLibrary::TYPE_COUNT] = {};
+    int treeSizeCount[TreeStampLibrary::SIZE_COUNT] = {};
+
+    for (const TreeSite& site : m_sites)
+    {
+        // Determine tree type based on biome
+        TreeType treeType = DetermineTreeType(site.biome, site.globalX, site.globalY);
+
+        // Select tree size based on noise value
+        TreeSize treeSize = SelectTreeSize(site.sizeValue);
+
+        // Precompiled stamp for this type and size
+        const CompiledTreeStamp& treeStamp = m_stampLibrary->GetStamp(treeType, treeSize);
+
+        // Border trees whose footprint misses this chunk place nothing here; skip them
+        // before paying for the ground height
+        if (!treeStamp.OverlapsColumns(site.globalX, site.globalY, chunkMinX, chunkMaxX, chunkMinY, chunkMaxY))
+        {
+            continue;
+        }
+
+        // Get ground height at this position (once; PlaceTree reuses it)
+        int groundHeight = GetTreeGroundHeight(chunkX, chunkY, site.globalX, site.globalY, treeStamp);
+
+        // Check if tree can be placed
+        if (!CanPlaceTree(site.globalX, site.globalY, groundHeight, treeStamp.height))
+        {
+            continue;
+        }
+
+        // Place tree from the compiled stamp
+        if (PlaceTree(chunk, stagingBlockIds, chunkX, chunkY, site.globalX, site.globalY, groundHeight, treeStamp))
+        {
+            treesPlaced++;
+
+            // Update statistics
+            treeTypeCount[static_cast<size_t>(treeType)]++;
+            treeSizeCount[static_cast<size_t>(treeSize)]++;
         }
     }
 
     // Log tree generation summary with type and size distribution
     LogDebug("TreeGenerator", "Generated %d trees for chunk (%d, %d)", treesPlaced, chunkX, chunkY);
 
-    // Log tree type distribution
-    if (!treeTypeCount.empty())
+    // Log tree type and size distribution
+    if (treesPlaced > 0)
     {
         std::string typeDistribution = "Tree types: ";
-        for (const auto& pair : treeTypeCount)
+        for (size_t type = 0; type < TreeStampLibrary::TYPE_COUNT; ++type)
         {
-            typeDistribution += pair.first + "=" + std::to_string(pair.second) + " ";
+            if (treeTypeCount[type] > 0)
+            {
+                typeDistribution += TreeStampLibrary::GetTypeName(static_cast<TreeType>(type));
+                typeDistribution += "=" + std::to_string(treeTypeCount[type]) + " ";
+            }
         }
         LogDebug("TreeGenerator", "%s", typeDistribution.c_str());
-    }
 
-    // Log tree size distribution
-    if (!treeSizeCount.empty())
-    {
         std::string sizeDistribution = "Tree sizes: ";
-        for (const auto& pair : treeSizeCount)
+        for (size_t size = 0; size < TreeStampLibrary::SIZE_COUNT; ++size)
         {
-            sizeDistribution += pair.first + "=" + std::to_string(pair.second) + " ";
+            if (treeSizeCount[size] > 0)
+            {
+                sizeDistribution += TreeStampLibrary::GetSizeName(static_cast<TreeSize>(size));
+                sizeDistribution += "=" + std::to_string(treeSizeCount[size]) + " ";
+            }
         }
         LogDebug("TreeGenerator", "%s", sizeDistribution.c_str());
     }
-
-    return true;
 }
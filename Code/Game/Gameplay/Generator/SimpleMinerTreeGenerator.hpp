@@ -1,19 +1,11 @@
 #pragma once
 #include "Engine/Voxel/Generation/TreeGenerator.hpp"
-#include "../TreeStamps/CactusStamp.hpp"
-#include <memory>
-#include <unordered_map>
-#include <string>
+#include "BiomeMap.hpp"
+#include "TreeStampLibrary.hpp"
+#include <vector>
 
-class TreeStamp;
 using namespace enigma::voxel;
 
-// Forward declarations
-namespace enigma::voxel
-{
-    class Biome;
-}
-
 /**
  * @brief SimpleMiner tree generation implementation
  *
@@ -22,29 +14,69 @@ namespace enigma::voxel
  * with biome-specific placement rules.
  *
  * Based on Professor Squirrel's noise-based local maximum algorithm.
+ *
+ * One instance per ChunkGen worker, reused across chunks (the base class noise cache is
+ * per-instance state). Stamps come from the generator's shared TreeStampLibrary.
  */
 // Forward declaration
 class SimpleMinerGenerator;
 
+/**
+ * @brief How tree origins are chosen
+ *
+ * - NoiseMaxima: every column of the placement bounds samples the tree noise and keeps local maxima
+ *   above the biome threshold (several noise evaluations per column)
+ * - JitteredGrid: one site per GridCell x GridCell cell at a hashed offset, kept with the biome's
+ *   acceptance probability (no noise per column; a different, similarly dense set of trees)
+ */
+enum class TreePlacementMode : uint8_t
+{
+    NoiseMaxima = 0,
+    JitteredGrid
+};
+
 class SimpleMinerTreeGenerator : public TreeGenerator
 {
 private:
-    // Tree stamp cache for different tree types and sizes
-    // Key format: "type_size" (e.g., "oak_small", "birch_medium")
-    std::unordered_map<std::string, std::shared_ptr<TreeStamp>> m_stampCache;
+    // Immutable stamps shared by all workers, owned by SimpleMinerGenerator
+    const TreeStampLibrary* m_stampLibrary;
 
     // Reference to SimpleMinerGenerator for biome queries
     const SimpleMinerGenerator* m_simpleMinerGenerator;
 
+    // Surface heightmap of the chunk being generated ([y][x] topmost solid Z), nullptr if unknown
+    const int* m_surfaceHeight = nullptr;
+
+    // Biomes of the chunk being generated plus its placement border, nullptr if unknown
+    const BiomeMap* m_biomeMap = nullptr;
+
+    // Tree origin selection (see TreePlacementMode)
+    TreePlacementMode m_placementMode = TreePlacementMode::NoiseMaxima;
+    int               m_gridCellSize  = 6;
+    uint32_t          m_placementSeed;
+
+    // Candidate tree origin of the chunk being generated
+    struct TreeSite
+    {
+        int                         globalX   = 0;
+        int                         globalY   = 0;
+        float                       sizeValue = 0.0f; // [0, 1], SelectTreeSize() input
+        BiomeId                     biome     = BiomeId::Count;
+    };
+
+    // Reused across chunks
+    std::vector<TreeSite> m_sites;
+
 public:
     /**
      * @brief Constructor
      * @param worldSeed Seed for world generation
      * @param terrainGenerator Reference to terrain generator for ground height queries
      * @param simpleMinerGenerator Reference to SimpleMinerGenerator for biome queries
+     * @param stampLibrary Tree stamps (must outlive this generator)
      */
     explicit SimpleMinerTreeGenerator(uint32_t                    worldSeed, const TerrainGenerator* terrainGenerator,
-                                      const SimpleMinerGenerator* simpleMinerGenerator);
+                                      const SimpleMinerGenerator* simpleMinerGenerator, const TreeStampLibrary* stampLibrary);
 
     /**
      * @brief Destructor
@@ -68,90 +100,142 @@ public:
      */
     bool GenerateTrees(Chunk* chunk, int32_t chunkX, int32_t chunkY) override;
 
-private:
     /**
-     * @brief Initialize tree stamp cache
-     * 
-     * Loads all tree stamp types (Oak, Birch, Spruce, Jungle, Acacia)
-     * into the cache for fast access during generation.
+     * @brief Same as GenerateTrees, but reads and writes the generator's block staging buffer
+     *
+     * Used by SimpleMinerGenerator::GenerateChunk before the staging buffer is committed, so tree
+     * blocks are written once together with the terrain.
+     *
+     * @param stagingBlockIds [z][y][x] numeric block IDs of the chunk (0xFFFF = no block)
      */
-    void InitializeStampCache();
+    bool GenerateTreesInStaging(uint16_t* stagingBlockIds, int32_t chunkX, int32_t chunkY);
 
     /**
-     * @brief Get tree stamp by type name
+     * @brief Provide the terrain pass heightmap of the chunk passed to the next GenerateTrees call
      *
-     * @param typeName Tree type name (e.g., "oak", "birch")
-     * @return Tree stamp instance, or nullptr if not found
+     * Trees whose whole footprint lies inside the chunk take their ground height from it
+     * instead of searching the density field.
+     *
+     * @param surfaceHeight 16x16 [y][x] topmost solid Z per column (-1 = none), or nullptr
      */
-    std::shared_ptr<TreeStamp> GetTreeStamp(const std::string& typeName) const;
+    void SetSurfaceHeightmap(const int* surfaceHeight) { m_surfaceHeight = surfaceHeight; }
 
     /**
-     * @brief Get or create tree stamp by type and size
+     * @brief Provide the biome map used by the next GenerateTrees call
      *
-     * Retrieves a tree stamp from cache, or creates a new one if not found.
-     * Uses factory methods (CreateSmall/CreateMedium/CreateLarge) to create stamps.
+     * Columns outside the map fall back to SimpleMinerGenerator::GetBiomeAt().
+     */
+    void SetBiomeMap(const BiomeMap* biomeMap) { m_biomeMap = biomeMap; }
+
+    /**
+     * @brief Inclusive world-space column range GenerateTrees considers for a chunk
+     *
+     * Tree origins outside the chunk are still evaluated so their overhanging blocks are placed;
+     * callers use this to size the biome map.
+     */
+    void GetPlacementBounds(int32_t chunkX, int32_t chunkY, int& minX, int& maxX, int& minY, int& maxY) const;
+
+    /**
+     * @brief Select how tree origins are chosen by subsequent GenerateTrees calls
+     * @param gridCellSize JitteredGrid cell width in blocks (>= 3)
+     */
+    void SetPlacementMode(TreePlacementMode mode, int gridCellSize);
+
+    TreePlacementMode GetPlacementMode() const { return m_placementMode; }
+
+    /**
+     * @brief Number of tree sites a mode accepts for a chunk, without ground queries or placement
      *
-     * @param treeType Tree type name (e.g., "oak", "birch", "spruce")
-     * @param treeSize Tree size name (e.g., "small", "medium", "large")
-     * @return Tree stamp instance, or nullptr if type is invalid
+     * Used by the placement comparison; sites are those of the whole placement bounds, before
+     * border trees that miss the chunk are rejected.
      */
-    std::shared_ptr<TreeStamp> GetOrCreateStamp(const std::string& treeType, const std::string& treeSize);
+    int CountTreeSites(int32_t chunkX, int32_t chunkY, TreePlacementMode mode);
 
+private:
     /**
      * @brief Determine tree type based on biome and position
      *
      * Uses biome information and noise values to select appropriate
      * tree type for the given position.
      *
+     * @param biome Biome at the position (BiomeId::Count = noise-based fallback)
      * @param globalX World X coordinate
      * @param globalY World Y coordinate (Z in Minecraft terms)
-     * @return Tree type name (e.g., "oak", "birch")
+     * @return Tree type
+     */
+    TreeType DetermineTreeType(BiomeId biome, int globalX, int globalY) const;
+
+    /**
+     * @brief Biome of a column: biome map if it covers the column, otherwise GetBiomeAt()
      */
-    std::string DetermineTreeType(int globalX, int globalY) const;
+    BiomeId LookupBiome(int globalX, int globalY) const;
 
     /**
-     * @brief Select tree type based on biome
+     * @brief Select tree type based on biome (per-biome rule table)
      *
      * Maps biome to appropriate tree type:
-     * - Desert -> Acacia
+     * - Desert -> Cactus (70%) or Acacia
      * - Jungle -> Jungle
-     * - Taiga/SnowyTaiga -> Spruce
-     * - Forest -> Oak or Birch (random)
+     * - Taiga -> Spruce, SnowyTaiga -> SpruceSnow
+     * - Forest/Plains -> Oak or Birch (random), SnowyPlains -> OakSnow
      * - Default -> Oak
      *
-     * @param biome Biome instance
+     * @param biome Biome at the position
      * @param globalX World X coordinate (for random variation)
      * @param globalY World Y coordinate (for random variation)
-     * @return Tree type name (e.g., "oak", "birch", "spruce")
+     * @return Tree type
      */
-    std::string SelectTreeType(const enigma::voxel::Biome* biome, int globalX, int globalY) const;
+    TreeType SelectTreeType(BiomeId biome, int globalX, int globalY) const;
 
     /**
      * @brief Select tree size based on noise value
      *
      * Maps noise value to tree size:
-     * - >= 0.95 -> "large"
-     * - >= 0.85 -> "medium"
-     * - < 0.85 -> "small"
+     * - >= 0.95 -> Large
+     * - >= 0.85 -> Medium
+     * - < 0.85 -> Small
      *
      * @param noiseValue Noise value in range [0, 1]
-     * @return Tree size name ("small", "medium", "large")
+     * @return Tree size
      */
-    std::string SelectTreeSize(float noiseValue) const;
+    TreeSize SelectTreeSize(float noiseValue) const;
 
     /**
      * @brief Get tree density threshold for biome
      *
-     * Returns the minimum noise value required for tree placement:
-     * - Forest: 0.7 (more trees)
-     * - Plains: 0.95 (sparse)
-     * - Desert: 0.98 (very sparse)
-     * - Default: 0.85
+     * Returns the minimum noise value required for tree placement (per-biome rule table):
+     * - Jungle: 0.78, Forest: 0.82 (dense)
+     * - Taiga: 0.88, Savanna: 0.94
+     * - Plains: 0.998, Desert: 0.999 (almost no trees)
+     * - Ocean, beach, peaks: 1.0 (none)
+     * - No biome: 0.7
      *
-     * @param biome Biome instance
+     * @param biome Biome at the position
      * @return Threshold value in range [0, 1]
      */
-    float GetTreeThreshold(const enigma::voxel::Biome* biome) const;
+    float GetTreeThreshold(BiomeId biome) const;
+
+    /**
+     * @brief Probability that a JitteredGrid cell holds a tree, derived from the noise threshold
+     *
+     * Linear in (1 - threshold): jungle (0.78) fills every cell, a threshold of 1.0 never places a tree.
+     */
+    float GetTreeAcceptance(float treeThreshold) const;
+
+    /**
+     * @brief Fill m_sites with the accepted tree origins of a chunk's placement bounds
+     */
+    void CollectTreeSites(int32_t chunkX, int32_t chunkY, TreePlacementMode mode);
+
+    /**
+     * @brief NoiseMaxima sites in [minX, maxX) x [minY, maxY)
+     */
+    void CollectNoiseMaximaSites(int minX, int maxX, int minY, int maxY);
+
+    /**
+     * @brief JitteredGrid sites in [minX, maxX) x [minY, maxY)
+     */
+    void CollectGridSites(int minX, int maxX, int minY, int maxY);
 
     /**
      * @brief Check if tree can be placed at position
@@ -169,22 +253,37 @@ private:
      */
     bool CanPlaceTree(int globalX, int globalY, int groundHeight, int treeHeight) const;
 
+    /**
+     * @brief Shared body of GenerateTrees / GenerateTreesInStaging (exactly one target is non-null)
+     */
+    void PlaceTrees(Chunk* chunk, uint16_t* stagingBlockIds, int32_t chunkX, int32_t chunkY);
+
     /**
      * @brief Place a tree at the specified position
      *
-     * Places all blocks from the tree stamp into the chunk, handling:
+     * Places all blocks from the compiled stamp into the chunk or staging buffer, handling:
      * - Cross-chunk boundaries (skips blocks outside current chunk)
-     * - Block replacement rules (only replaces air, grass, leaves)
-     * - Block state management
+     * - Block replacement rules (TreeStampLibrary::CanPlace: never terrain, higher rank / ID wins between trees)
      *
-     * @param chunk Chunk to place tree in
+     * @param chunk Chunk to place tree in (used when stagingBlockIds is null)
+     * @param stagingBlockIds Staging buffer to place tree in, or nullptr
      * @param chunkX Chunk X coordinate
      * @param chunkY Chunk Y coordinate (Z in Minecraft terms)
      * @param globalX World X coordinate of tree origin
      * @param globalY World Y coordinate of tree origin
-     * @param stamp Tree stamp to place
+     * @param groundZ Ground height at the tree origin
+     * @param stamp Compiled tree stamp to place
      * @return true if at least one block was placed
      */
-    bool PlaceTree(Chunk* chunk, int32_t chunkX, int32_t           chunkY,
-                   int    globalX, int   globalY, const TreeStamp& stamp);
+    bool PlaceTree(Chunk* chunk, uint16_t* stagingBlockIds, int32_t chunkX, int32_t chunkY,
+                   int    globalX, int       globalY, int          groundZ, const CompiledTreeStamp& stamp);
+
+    /**
+     * @brief Ground height for a tree origin
+     *
+     * Uses the surface heightmap when every block of the stamp falls inside this chunk
+     * (no neighbour places any part of it, so they cannot disagree on the height);
+     * otherwise asks the generator for the exact, generation-order independent height.
+     */
+    int GetTreeGroundHeight(int32_t chunkX, int32_t chunkY, int globalX, int globalY, const CompiledTreeStamp& stamp) const;
 };
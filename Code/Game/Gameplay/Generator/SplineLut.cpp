@@ -0,0 +1,58 @@
+#include "SplineLut.hpp"
+#include <cmath>
+
+namespace
+{
+    // Verification samples per table segment (segment ends are exact by construction)
+    constexpr int VERIFY_SAMPLES_PER_SEGMENT = 8;
+}
+
+bool SplineLut::Bake(const std::function<float(float)>& curve, float minInput, float maxInput,
+                     int                                resolution, float tolerance, float* outMaxError)
+{
+    m_values.clear();
+    if (!curve || resolution < 2 || !(maxInput > minInput))
+    {
+        return false;
+    }
+
+    const float step = (maxInput - minInput) / static_cast<float>(resolution - 1);
+    std::vector<float> values(resolution);
+    for (int i = 0; i < resolution; ++i)
+    {
+        values[i] = curve(minInput + step * static_cast<float>(i));
+    }
+
+    m_minInput    = minInput;
+    m_maxInput    = maxInput;
+    m_inverseStep = 1.0f / step;
+    m_lastSegment = resolution - 2;
+    m_values      = std::move(values);
+
+    // Compare the interpolated table against the exact curve inside every segment
+    float maxError = 0.0f;
+    for (int segment = 0; segment <= m_lastSegment; ++segment)
+    {
+        for (int sample = 1; sample < VERIFY_SAMPLES_PER_SEGMENT; ++sample)
+        {
+            float input = minInput + step * (static_cast<float>(segment) +
+                static_cast<float>(sample) / static_cast<float>(VERIFY_SAMPLES_PER_SEGMENT));
+            float error = std::fabs(Evaluate(input) - curve(input));
+            if (error > maxError)
+            {
+                maxError = error;
+            }
+        }
+    }
+
+    if (outMaxError)
+    {
+        *outMaxError = maxError;
+    }
+    if (maxError > tolerance)
+    {
+        m_values.clear();
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,56 @@
+#pragma once
+#include <functional>
+#include <vector>
+
+/**
+ * @brief Fixed-resolution lookup table of a 1D curve with linear interpolation
+ *
+ * SimpleMinerGenerator bakes its terrain splines (height offset, squashing, erosion) into
+ * tables at construction, so evaluating a spline is two loads and a lerp instead of a
+ * point search plus cubic Hermite evaluation.
+ *
+ * Bake() measures the interpolation error against the exact curve between table entries;
+ * a table that misses the tolerance is discarded and callers keep using the exact curve.
+ * Inputs outside the baked range are not covered (Contains() is false).
+ */
+class SplineLut
+{
+public:
+    /**
+     * @brief Sample curve at resolution evenly spaced inputs covering [minInput, maxInput]
+     * @param outMaxError Largest |table - curve| seen while verifying (optional)
+     * @return true if the table is within tolerance (otherwise the table is left empty)
+     */
+    bool Bake(const std::function<float(float)>& curve, float minInput, float maxInput,
+              int                                resolution, float tolerance, float* outMaxError = nullptr);
+
+    bool IsBaked() const { return !m_values.empty(); }
+
+    bool Contains(float input) const
+    {
+        return IsBaked() && input >= m_minInput && input <= m_maxInput;
+    }
+
+    /**
+     * @brief Interpolated table value; input must satisfy Contains()
+     */
+    float Evaluate(float input) const
+    {
+        float position = (input - m_minInput) * m_inverseStep;
+        int   index    = static_cast<int>(position);
+        if (index > m_lastSegment)
+        {
+            index = m_lastSegment;
+        }
+        float fraction = position - static_cast<float>(index);
+        float v0       = m_values[index];
+        return v0 + (m_values[index + 1] - v0) * fraction;
+    }
+
+private:
+    std::vector<float> m_values;
+    float              m_minInput    = 0.0f;
+    float              m_maxInput    = 0.0f;
+    float              m_inverseStep = 0.0f;
+    int                m_lastSegment = 0; // Index of the last [i, i + 1] segment
+};
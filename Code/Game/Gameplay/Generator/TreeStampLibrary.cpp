@@ -0,0 +1,171 @@
+#include "TreeStampLibrary.hpp"
+#include "../TreeStamps/OakTreeStamp.hpp"
+#include "../TreeStamps/OakSnowTreeStamp.hpp"
+#include "../TreeStamps/BirchTreeStamp.hpp"
+#include "../TreeStamps/SpruceTreeStamp.hpp"
+#include "../TreeStamps/SpruceSnowTreeStamp.hpp"
+#include "../TreeStamps/JungleTreeStamp.hpp"
+#include "../TreeStamps/AcaciaTreeStamp.hpp"
+#include "../TreeStamps/CactusStamp.hpp"
+#include "Engine/Registry/Block/BlockRegistry.hpp"
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include <algorithm>
+#include <string>
+
+using namespace enigma::registry::block;
+
+TreeStampLibrary::TreeStampLibrary()
+{
+    AddVariants<OakTreeStamp>(TreeType::Oak);
+    AddVariants<OakSnowTreeStamp>(TreeType::OakSnow);
+    AddVariants<BirchTreeStamp>(TreeType::Birch);
+    AddVariants<SpruceTreeStamp>(TreeType::Spruce);
+    AddVariants<SpruceSnowTreeStamp>(TreeType::SpruceSnow);
+    AddVariants<JungleTreeStamp>(TreeType::Jungle);
+    AddVariants<AcaciaTreeStamp>(TreeType::Acacia);
+    AddVariants<CactusStamp>(TreeType::Cactus);
+
+    BuildPlacementRanks();
+
+    size_t replaceableCount = static_cast<size_t>(std::count_if(m_placementRank.begin(), m_placementRank.end(),
+                                                                [](uint8_t rank) { return rank != RANK_SOLID; }));
+    LogInfo("TreeGenerator", "Initialized tree stamp library: %zu types x %zu sizes, %zu replaceable blocks",
+            TYPE_COUNT, SIZE_COUNT, replaceableCount);
+}
+
+template <typename Stamp>
+void TreeStampLibrary::AddVariants(TreeType type)
+{
+    m_stamps[GetIndex(type, TreeSize::Small)]  = Compile(Stamp::CreateSmall());
+    m_stamps[GetIndex(type, TreeSize::Medium)] = Compile(Stamp::CreateMedium());
+    m_stamps[GetIndex(type, TreeSize::Large)]  = Compile(Stamp::CreateLarge());
+}
+
+CompiledTreeStamp TreeStampLibrary::Compile(const TreeStamp& stamp)
+{
+    CompiledTreeStamp compiled;
+    compiled.height = stamp.GetHeight();
+    compiled.blocks.reserve(stamp.GetBlocks().size());
+
+    bool first = true;
+    for (const TreeStampBlock& stampBlock : stamp.GetBlocks())
+    {
+        const IntVec3& offset = stampBlock.offset;
+        if (offset.x < INT8_MIN || offset.x > INT8_MAX || offset.y < INT8_MIN || offset.y > INT8_MAX ||
+            offset.z < INT16_MIN || offset.z > INT16_MAX)
+        {
+            LogWarn("TreeGenerator", "%s stamp block offset (%d, %d, %d) out of range, skipped",
+                    stamp.GetTypeName().c_str(), offset.x, offset.y, offset.z);
+            continue;
+        }
+
+        auto block = (stampBlock.blockId >= 0 && stampBlock.blockId < 0xFFFF) ? BlockRegistry::GetBlockById(stampBlock.blockId) : nullptr;
+        auto* state = block ? block->GetDefaultState() : nullptr;
+        if (!state)
+        {
+            LogWarn("TreeGenerator", "%s stamp: no block state for ID %d, block skipped", stamp.GetTypeName().c_str(), stampBlock.blockId);
+            continue;
+        }
+
+        CompiledTreeStamp::Block compiledBlock;
+        compiledBlock.offsetX = static_cast<int8_t>(offset.x);
+        compiledBlock.offsetY = static_cast<int8_t>(offset.y);
+        compiledBlock.offsetZ = static_cast<int16_t>(offset.z);
+        compiledBlock.blockId = static_cast<uint16_t>(stampBlock.blockId);
+        compiledBlock.state   = state;
+        compiled.blocks.push_back(compiledBlock);
+
+        compiled.minX = first ? offset.x : (std::min)(compiled.minX, offset.x);
+        compiled.maxX = first ? offset.x : (std::max)(compiled.maxX, offset.x);
+        compiled.minY = first ? offset.y : (std::min)(compiled.minY, offset.y);
+        compiled.maxY = first ? offset.y : (std::max)(compiled.maxY, offset.y);
+        compiled.maxZ = first ? offset.z : (std::max)(compiled.maxZ, offset.z);
+        first         = false;
+    }
+    return compiled;
+}
+
+void TreeStampLibrary::BuildPlacementRanks()
+{
+    m_placementRank.fill(RANK_SOLID);
+
+    // Same names PlaceTree used to treat as replaceable; leaves rank above the ground they replace
+    for (const auto& block : BlockRegistry::GetBlocksByNamespace("simpleminer"))
+    {
+        if (!block)
+        {
+            continue;
+        }
+        int blockId = block->GetNumericId();
+        if (blockId < 0 || blockId >= static_cast<int>(BLOCK_ID_COUNT))
+        {
+            continue;
+        }
+
+        std::string blockName = block->GetRegistryName();
+        if (blockName.find("leaves") != std::string::npos)
+        {
+            m_placementRank[static_cast<size_t>(blockId)] = RANK_LEAVES;
+        }
+        else if (blockName == "air" || blockName == "water" || blockName.find("grass") != std::string::npos)
+        {
+            m_placementRank[static_cast<size_t>(blockId)] = RANK_GROUND;
+        }
+    }
+
+    // Logs, cactus, ...: never replaced by terrain rules, but ordered against other trees' blocks
+    for (const CompiledTreeStamp& stamp : m_stamps)
+    {
+        for (const CompiledTreeStamp::Block& stampBlock : stamp.blocks)
+        {
+            uint8_t& rank = m_placementRank[stampBlock.blockId];
+            if (rank == RANK_SOLID)
+            {
+                rank = RANK_TREE;
+            }
+        }
+    }
+
+    // "No block" may always be filled
+    m_placementRank[NO_BLOCK_ID] = RANK_GROUND;
+}
+
+const char* TreeStampLibrary::GetTypeName(TreeType type)
+{
+    switch (type)
+    {
+    case TreeType::Oak:
+        return "oak";
+    case TreeType::OakSnow:
+        return "oak_snow";
+    case TreeType::Birch:
+        return "birch";
+    case TreeType::Spruce:
+        return "spruce";
+    case TreeType::SpruceSnow:
+        return "spruce_snow";
+    case TreeType::Jungle:
+        return "jungle";
+    case TreeType::Acacia:
+        return "acacia";
+    case TreeType::Cactus:
+        return "cactus";
+    default:
+        return "unknown";
+    }
+}
+
+const char* TreeStampLibrary::GetSizeName(TreeSize size)
+{
+    switch (size)
+    {
+    case TreeSize::Small:
+        return "small";
+    case TreeSize::Medium:
+        return "medium";
+    case TreeSize::Large:
+        return "large";
+    default:
+        return "unknown";
+    }
+}
@@ -0,0 +1,142 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class TreeStamp;
+
+namespace enigma::voxel
+{
+    class BlockState;
+}
+
+enum class TreeType : uint8_t
+{
+    Oak = 0,
+    OakSnow,
+    Birch,
+    Spruce,
+    SpruceSnow,
+    Jungle,
+    Acacia,
+    Cactus,
+    Count
+};
+
+enum class TreeSize : uint8_t
+{
+    Small = 0,
+    Medium,
+    Large,
+    Count
+};
+
+/**
+ * @brief A TreeStamp resolved for placement: flat block list plus its bounding box
+ *
+ * Offsets are relative to the tree origin (trunk base on the ground block). The box is inclusive
+ * and lets placement reject trees whose footprint misses the target chunk without touching blocks.
+ */
+struct CompiledTreeStamp
+{
+    struct Block
+    {
+        int8_t                     offsetX = 0;
+        int8_t                     offsetY = 0;
+        int16_t                    offsetZ = 0;
+        uint16_t                   blockId = 0; // Numeric block ID (fits the generator staging buffer)
+        enigma::voxel::BlockState* state   = nullptr; // Default state of blockId
+    };
+
+    std::vector<Block> blocks;
+    int                minX   = 0;
+    int                maxX   = 0;
+    int                minY   = 0;
+    int                maxY   = 0;
+    int                maxZ   = 0;
+    int                height = 0; // TreeStamp::GetHeight()
+
+    /**
+     * @brief Whether a tree at (globalX, globalY) has any block in columns [minX, maxX] x [minY, maxY]
+     */
+    bool OverlapsColumns(int globalX, int globalY, int columnMinX, int columnMaxX, int columnMinY, int columnMaxY) const
+    {
+        return globalX + maxX >= columnMinX && globalX + minX <= columnMaxX &&
+            globalY + maxY >= columnMinY && globalY + minY <= columnMaxY;
+    }
+
+    /**
+     * @brief Whether every block of a tree at (globalX, globalY) lies in columns [minX, maxX] x [minY, maxY]
+     */
+    bool InsideColumns(int globalX, int globalY, int columnMinX, int columnMaxX, int columnMinY, int columnMaxY) const
+    {
+        return globalX + minX >= columnMinX && globalX + maxX <= columnMaxX &&
+            globalY + minY >= columnMinY && globalY + maxY <= columnMaxY;
+    }
+};
+
+/**
+ * @brief Every tree stamp variant, compiled once and indexed by (TreeType, TreeSize)
+ *
+ * Stamps resolve their block IDs and default states from the BlockRegistry when compiled, so the
+ * library must be built after block registration (SimpleMinerGenerator builds it in its constructor).
+ * After that it is immutable and shared read-only by the tree generators of all ChunkGen threads.
+ *
+ * Also owns the placement rank of every numeric block ID, which decides what a tree block may
+ * overwrite: ground (air, water, grass*, the all-ones "no block" ID) < leaves (*leaves*) < other stamp
+ * blocks (logs, cactus) < everything else (never overwritten). Where tree blocks meet, the higher
+ * (rank, ID) wins, so the result does not depend on the order trees are placed in.
+ */
+class TreeStampLibrary
+{
+public:
+    static constexpr size_t   TYPE_COUNT     = static_cast<size_t>(TreeType::Count);
+    static constexpr size_t   SIZE_COUNT     = static_cast<size_t>(TreeSize::Count);
+    static constexpr size_t   BLOCK_ID_COUNT = 0x10000;
+    static constexpr uint16_t NO_BLOCK_ID    = 0xFFFF; // Empty chunk voxel / untouched staging entry
+
+    TreeStampLibrary();
+
+    const CompiledTreeStamp& GetStamp(TreeType type, TreeSize size) const
+    {
+        return m_stamps[GetIndex(type, size)];
+    }
+
+    /**
+     * @brief Whether a tree block may overwrite an existing block (see the class comment)
+     *
+     * A maximum over (rank, ID): applying the same set of tree blocks in any order gives the same result.
+     */
+    bool CanPlace(uint16_t existingId, uint16_t treeBlockId) const
+    {
+        uint8_t existingRank = m_placementRank[existingId];
+        uint8_t treeRank     = m_placementRank[treeBlockId];
+        return existingRank != RANK_SOLID &&
+            (treeRank > existingRank || (treeRank == existingRank && treeBlockId > existingId));
+    }
+
+    static const char* GetTypeName(TreeType type);
+    static const char* GetSizeName(TreeSize size);
+
+private:
+    static size_t GetIndex(TreeType type, TreeSize size)
+    {
+        return static_cast<size_t>(type) * SIZE_COUNT + static_cast<size_t>(size);
+    }
+
+    static CompiledTreeStamp Compile(const TreeStamp& stamp);
+
+    template <typename Stamp>
+    void AddVariants(TreeType type);
+
+    void BuildPlacementRanks();
+
+    static constexpr uint8_t RANK_GROUND = 0;
+    static constexpr uint8_t RANK_LEAVES = 1;
+    static constexpr uint8_t RANK_TREE   = 2;
+    static constexpr uint8_t RANK_SOLID  = 3;
+
+    std::array<CompiledTreeStamp, TYPE_COUNT * SIZE_COUNT> m_stamps;
+    std::array<uint8_t, BLOCK_ID_COUNT>                   m_placementRank = {};
+};
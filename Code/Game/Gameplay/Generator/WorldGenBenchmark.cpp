@@ -0,0 +1,398 @@
+#include "WorldGenBenchmark.hpp"
+#include "SimpleMinerGenerator.hpp"
+#include "FeatureRandom.hpp"
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    constexpr int MAX_RADIUS_CHUNKS     = 256;
+    constexpr int MAX_THREADS           = 256;
+    constexpr int MAX_PARALLEL_PASSES   = 64;
+    constexpr int MAX_LOGGED_MISMATCHES = 32;
+
+    std::atomic<uint64_t> s_allocationCount{0};
+
+    uint64_t GetAllocationCount()
+    {
+        return s_allocationCount.load(std::memory_order_relaxed);
+    }
+
+    struct BenchmarkRun
+    {
+        int                   threadCount = 0;
+        double                seconds     = 0.0;
+        uint64_t              allocations = 0;
+        uint64_t              stageMicros[PROTO_CHUNK_STAGE_COUNT] = {};
+        uint64_t              stageCounts[PROTO_CHUNK_STAGE_COUNT] = {};
+        uint64_t              featureStepMicros[FEATURE_STEP_COUNT] = {};
+        std::vector<uint64_t> chunkHashes; // Same order as the chunk list
+        bool                  completed = true;
+    };
+
+    BenchmarkRun RunOnce(const WorldGenBenchmarkRequest& request, const WorldGenConfig& config, const std::vector<IntVec2>& chunks, int threadCount)
+    {
+        BenchmarkRun run;
+        run.threadCount = threadCount;
+        run.chunkHashes.assign(chunks.size(), 0);
+
+        auto generator = std::make_unique<SimpleMinerGenerator>(request.seed, config);
+
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<bool>   failed{false};
+        uint64_t            allocationsBefore = GetAllocationCount();
+        auto                start             = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> workers;
+        workers.reserve(threadCount);
+        for (int worker = 0; worker < threadCount; ++worker)
+        {
+            workers.emplace_back([&]()
+            {
+                for (size_t index = nextChunk.fetch_add(1); index < chunks.size(); index = nextChunk.fetch_add(1))
+                {
+                    if (!generator->GenerateDetachedChunkHash(chunks[index].x, chunks[index].y, run.chunkHashes[index]))
+                    {
+                        failed.store(true, std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+        for (std::thread& worker : workers)
+        {
+            worker.join();
+        }
+
+        run.seconds     = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        run.allocations = GetAllocationCount() - allocationsBefore;
+        run.completed   = !failed.load();
+        generator->GetStageTotals(run.stageMicros, run.stageCounts);
+        generator->GetFeatureStepTotals(run.featureStepMicros);
+        return run;
+    }
+
+    uint64_t CombineHashes(const std::vector<uint64_t>& chunkHashes)
+    {
+        uint64_t hash = SimpleMinerGenerator::CONTENT_HASH_OFFSET;
+        for (uint64_t chunkHash : chunkHashes)
+        {
+            hash = (hash ^ chunkHash) * SimpleMinerGenerator::CONTENT_HASH_PRIME;
+        }
+        return hash;
+    }
+
+    double StageMsPerChunk(const BenchmarkRun& run, ProtoChunkStatus stage)
+    {
+        size_t index = ToStageIndex(stage);
+        return run.stageCounts[index] ? run.stageMicros[index] / 1000.0 / static_cast<double>(run.stageCounts[index]) : 0.0;
+    }
+
+    // Per chunk that completed the Features stage, like the stage itself
+    double FeatureStepMsPerChunk(const BenchmarkRun& run, FeatureStep step)
+    {
+        uint64_t count = run.stageCounts[ToStageIndex(ProtoChunkStatus::Features)];
+        return count ? run.featureStepMicros[static_cast<size_t>(step)] / 1000.0 / static_cast<double>(count) : 0.0;
+    }
+
+    std::vector<IntVec2> BuildChunkList(const WorldGenBenchmarkRequest& request)
+    {
+        std::vector<IntVec2> chunks;
+        for (int y = -request.radiusChunks; y <= request.radiusChunks; ++y)
+        {
+            for (int x = -request.radiusChunks; x <= request.radiusChunks; ++x)
+            {
+                chunks.emplace_back(request.centerChunk.x + x, request.centerChunk.y + y);
+            }
+        }
+        return chunks;
+    }
+
+    // Seeded Fisher-Yates permutation of chunk indices (same seed and pass, same order)
+    std::vector<size_t> ShuffleChunkOrder(size_t chunkCount, uint32_t seed, int pass)
+    {
+        std::vector<size_t> order(chunkCount);
+        std::iota(order.begin(), order.end(), static_cast<size_t>(0));
+
+        FeatureRandom random(seed, 0, 0, static_cast<uint32_t>(pass));
+        for (size_t index = chunkCount; index > 1; --index)
+        {
+            std::swap(order[index - 1], order[static_cast<size_t>(random.RangeInt(0, static_cast<int>(index - 1)))]);
+        }
+        return order;
+    }
+
+    int ResolveMaxThreads(const WorldGenBenchmarkRequest& request)
+    {
+        int maxThreads = request.maxThreads > 0 ? request.maxThreads : static_cast<int>(std::thread::hardware_concurrency());
+        return (std::max)(maxThreads, 1);
+    }
+}
+
+#if WORLDGEN_BENCH_COUNT_ALLOCATIONS
+// Global replacements (array and sized forms forward here by default); aligned new is not counted
+void* operator new(size_t size)
+{
+    s_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+#endif
+
+CommandLineRequest WorldGenBenchmark::ParseCommandLine(const char* commandLine, WorldGenBenchmarkRequest& outRequest)
+{
+    if (!commandLine)
+    {
+        return CommandLineRequest::NotRequested;
+    }
+
+    std::istringstream tokens(commandLine);
+    std::string        token;
+    bool               requested = false;
+    bool               valid     = true;
+    while (tokens >> token)
+    {
+        if (token == "-worldgenbench" || token == "--worldgenbench")
+        {
+            requested = true;
+            continue;
+        }
+        if (token == "-worldgenverify" || token == "--worldgenverify")
+        {
+            requested                    = true;
+            outRequest.verifyDeterminism = true;
+            continue;
+        }
+
+        size_t separator = token.find('=');
+        if (!requested || separator == std::string::npos)
+        {
+            continue;
+        }
+        std::string key   = token.substr(0, separator);
+        std::string value = token.substr(separator + 1);
+        char*       end   = nullptr;
+        if (key == "seed")
+        {
+            outRequest.seed = static_cast<uint32_t>(std::strtoul(value.c_str(), &end, 10));
+            valid           = valid && end && *end == '\0' && !value.empty();
+        }
+        else if (key == "center")
+        {
+            int x = 0, y = 0;
+            valid                  = valid && std::sscanf(value.c_str(), "%d,%d", &x, &y) == 2;
+            outRequest.centerChunk = IntVec2(x, y);
+        }
+        else if (key == "radius")
+        {
+            outRequest.radiusChunks = static_cast<int>(std::strtol(value.c_str(), &end, 10));
+            valid                   = valid && end && *end == '\0' && !value.empty();
+        }
+        else if (key == "threads")
+        {
+            outRequest.maxThreads = static_cast<int>(std::strtol(value.c_str(), &end, 10));
+            valid                 = valid && end && *end == '\0' && !value.empty();
+        }
+        else if (key == "passes")
+        {
+            outRequest.parallelPasses = static_cast<int>(std::strtol(value.c_str(), &end, 10));
+            valid                     = valid && end && *end == '\0' && !value.empty();
+        }
+        else
+        {
+            LogWarn("WorldGenBenchmark", "Unknown benchmark option '%s'", key.c_str());
+        }
+    }
+
+    if (!requested)
+    {
+        return CommandLineRequest::NotRequested;
+    }
+    if (!valid || outRequest.radiusChunks < 0 || outRequest.radiusChunks > MAX_RADIUS_CHUNKS ||
+        outRequest.maxThreads < 0 || outRequest.maxThreads > MAX_THREADS ||
+        outRequest.parallelPasses < 1 || outRequest.parallelPasses > MAX_PARALLEL_PASSES)
+    {
+        LogError("WorldGenBenchmark", "Usage: -worldgenbench [seed=<n>] [center=<chunkX>,<chunkY>] [radius=<0-%d>] [threads=<0-%d>]",
+                 MAX_RADIUS_CHUNKS, MAX_THREADS);
+        LogError("WorldGenBenchmark", "       -worldgenverify [seed=<n>] [center=<chunkX>,<chunkY>] [radius=<0-%d>] [threads=<0-%d>] [passes=<1-%d>]",
+                 MAX_RADIUS_CHUNKS, MAX_THREADS, MAX_PARALLEL_PASSES);
+        return CommandLineRequest::Invalid;
+    }
+    return CommandLineRequest::Valid;
+}
+
+bool WorldGenBenchmark::Run(const WorldGenBenchmarkRequest& request, const WorldGenConfig& config)
+{
+    if (request.verifyDeterminism)
+    {
+        return VerifyDeterminism(request, config);
+    }
+
+    std::vector<IntVec2> chunks     = BuildChunkList(request);
+    int                  maxThreads = ResolveMaxThreads(request);
+
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < maxThreads; threads *= 2)
+    {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(maxThreads);
+
+    LogInfo("WorldGenBenchmark", "Generating %zu chunks around (%d, %d), seed %u, on 1..%d threads%s", chunks.size(),
+            request.centerChunk.x, request.centerChunk.y, request.seed, maxThreads,
+            WORLDGEN_BENCH_COUNT_ALLOCATIONS ? "" : " (allocation counting not compiled in)");
+
+    bool         allMatch = true;
+    BenchmarkRun reference;
+    for (int threadCount : threadCounts)
+    {
+        BenchmarkRun run = RunOnce(request, config, chunks, threadCount);
+        if (!run.completed)
+        {
+            LogError("WorldGenBenchmark", "Run on %d threads was cancelled", threadCount);
+            return false;
+        }
+        if (reference.chunkHashes.empty())
+        {
+            reference = run;
+        }
+
+        size_t mismatches = 0;
+        for (size_t index = 0; index < chunks.size(); ++index)
+        {
+            if (run.chunkHashes[index] != reference.chunkHashes[index])
+            {
+                ++mismatches;
+            }
+        }
+        allMatch = allMatch && mismatches == 0;
+
+        double chunkCount         = static_cast<double>(chunks.size());
+        char   allocsPerChunk[32] = "n/a";
+        if (WORLDGEN_BENCH_COUNT_ALLOCATIONS)
+        {
+            std::snprintf(allocsPerChunk, sizeof(allocsPerChunk), "%.1f", static_cast<double>(run.allocations) / chunkCount);
+        }
+        LogInfo("WorldGenBenchmark",
+                "%3d threads: %8.1f chunks/s | ms/chunk climate %.2f shape %.2f surface %.2f features %.2f "
+                "(trees %.2f caves %.2f ores %.2f) | %s allocs/chunk | hash %016llx%s",
+                threadCount, chunkCount / (std::max)(run.seconds, 1e-9),
+                StageMsPerChunk(run, ProtoChunkStatus::Climate), StageMsPerChunk(run, ProtoChunkStatus::Shape),
+                StageMsPerChunk(run, ProtoChunkStatus::Surface), StageMsPerChunk(run, ProtoChunkStatus::Features),
+                FeatureStepMsPerChunk(run, FeatureStep::Trees), FeatureStepMsPerChunk(run, FeatureStep::Caves),
+                FeatureStepMsPerChunk(run, FeatureStep::OreVeins),
+                allocsPerChunk, static_cast<unsigned long long>(CombineHashes(run.chunkHashes)),
+                mismatches ? " MISMATCH" : "");
+        if (mismatches)
+        {
+            LogError("WorldGenBenchmark", "%zu of %zu chunks differ from the single-threaded run", mismatches, chunks.size());
+        }
+    }
+    return allMatch;
+}
+
+bool WorldGenBenchmark::VerifyDeterminism(const WorldGenBenchmarkRequest& request, const WorldGenConfig& config)
+{
+    std::vector<IntVec2> chunks     = BuildChunkList(request);
+    int                  maxThreads = ResolveMaxThreads(request);
+
+    LogInfo("WorldGenBenchmark", "Verifying %zu chunks around (%d, %d), seed %u: 1 thread vs %d threads x %d shuffled passes", chunks.size(),
+            request.centerChunk.x, request.centerChunk.y, request.seed, maxThreads, request.parallelPasses);
+
+    // Row-major reference: border trees towards later chunks always take their height from a density scan
+    std::vector<uint64_t> reference;
+    {
+        auto generator = std::make_unique<SimpleMinerGenerator>(request.seed, config);
+        if (!generator->GenerateRegionHashes(chunks, 1, reference))
+        {
+            LogError("WorldGenBenchmark", "Single-threaded verification run was cancelled");
+            return false;
+        }
+    }
+
+    // A chunk that differs in any pass depends on the order its neighbours were generated in.
+    // Each pass shuffles the chunk order, so border trees read published neighbour heights in some
+    // chunks and scan density in others, which is then compared against the reference.
+    std::vector<bool> differs(chunks.size(), false);
+    for (int pass = 0; pass < request.parallelPasses; ++pass)
+    {
+        std::vector<size_t>  order = ShuffleChunkOrder(chunks.size(), request.seed, pass);
+        std::vector<IntVec2> shuffledChunks;
+        shuffledChunks.reserve(chunks.size());
+        for (size_t index : order)
+        {
+            shuffledChunks.push_back(chunks[index]);
+        }
+
+        std::vector<uint64_t> shuffledHashes;
+        auto                  generator = std::make_unique<SimpleMinerGenerator>(request.seed, config);
+        if (!generator->GenerateRegionHashes(shuffledChunks, maxThreads, shuffledHashes))
+        {
+            LogError("WorldGenBenchmark", "Verification pass %d on %d threads was cancelled", pass + 1, maxThreads);
+            return false;
+        }
+
+        std::vector<uint64_t> hashes(chunks.size(), 0);
+        for (size_t position = 0; position < order.size(); ++position)
+        {
+            hashes[order[position]] = shuffledHashes[position];
+        }
+
+        size_t mismatches = 0;
+        for (size_t index = 0; index < chunks.size(); ++index)
+        {
+            if (hashes[index] != reference[index])
+            {
+                ++mismatches;
+                differs[index] = true;
+            }
+        }
+        LogInfo("WorldGenBenchmark", "Pass %d: hash %016llx vs %016llx, %zu chunks differ", pass + 1,
+                static_cast<unsigned long long>(CombineHashes(hashes)), static_cast<unsigned long long>(CombineHashes(reference)), mismatches);
+    }
+
+    size_t flagged = 0;
+    for (size_t index = 0; index < chunks.size(); ++index)
+    {
+        if (!differs[index])
+        {
+            continue;
+        }
+        if (++flagged <= MAX_LOGGED_MISMATCHES)
+        {
+            LogError("WorldGenBenchmark", "Chunk (%d, %d) depends on generation order", chunks[index].x, chunks[index].y);
+        }
+    }
+
+    if (flagged)
+    {
+        LogError("WorldGenBenchmark", "%zu of %zu chunks are scheduling dependent%s", flagged, chunks.size(),
+                 flagged > MAX_LOGGED_MISMATCHES ? " (first ones listed)" : "");
+        return false;
+    }
+    LogInfo("WorldGenBenchmark", "All %zu chunks match the single-threaded run", chunks.size());
+    return true;
+}
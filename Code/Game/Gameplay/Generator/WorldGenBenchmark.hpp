@@ -0,0 +1,71 @@
+#pragma once
+#include "CommandLineRequest.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include <cstdint>
+
+struct WorldGenConfig;
+
+// Count heap allocations per chunk by replacing the global operator new in WorldGenBenchmark.cpp.
+// Off by default: the replacement applies to the whole game, not only to benchmark runs.
+#ifndef WORLDGEN_BENCH_COUNT_ALLOCATIONS
+#define WORLDGEN_BENCH_COUNT_ALLOCATIONS 0
+#endif
+
+/**
+ * @brief Parameters of a generator benchmark (command line: -worldgenbench [seed=<n>] [center=<chunkX>,<chunkY>] [radius=<chunks>] [threads=<n>])
+ *
+ * -worldgenverify takes the same options plus [passes=<n>] and runs the determinism check instead.
+ */
+struct WorldGenBenchmarkRequest
+{
+    uint32_t seed              = 12345;
+    IntVec2  centerChunk       = IntVec2(0, 0);
+    int      radiusChunks      = 8; // Square of (2 * radius + 1)^2 chunks per run
+    int      maxThreads        = 0; // 0 = std::thread::hardware_concurrency()
+    bool     verifyDeterminism = false;
+    int      parallelPasses    = 3; // Determinism check: parallel runs compared against the single-threaded one
+};
+
+/**
+ * @brief Measures SimpleMinerGenerator without a World, renderer or chunk storage
+ *
+ * Generates the same square of chunks once per thread count (1, 2, 4, ... maxThreads) through
+ * SimpleMinerGenerator::GenerateDetachedChunkHash on plain std::threads. Every run gets a fresh
+ * generator, so none inherits the climate / heightmap caches of the previous one.
+ *
+ * Reports chunks/s, per-stage time per chunk (climate, shape incl. water, surface, features split
+ * into trees / caves / ores), heap allocations per chunk (WORLDGEN_BENCH_COUNT_ALLOCATIONS builds) and
+ * a region content hash that must not change with the thread count. Chunks are not committed, so
+ * the engine-side Chunk::SetBlock cost of the commit stage is not part of the numbers.
+ */
+class WorldGenBenchmark
+{
+public:
+    /**
+     * @brief Parse "-worldgenbench ..." or "-worldgenverify ..." from the command line
+     * @return Invalid if the options are malformed or out of range (logged)
+     */
+    static CommandLineRequest ParseCommandLine(const char* commandLine, WorldGenBenchmarkRequest& outRequest);
+
+    /**
+     * @brief Run every thread count and log the results (blocks until done)
+     *
+     * Runs VerifyDeterminism instead if the request asks for it.
+     * @return false if a run was cancelled or its content hashes differ from the single-threaded run
+     */
+    static bool Run(const WorldGenBenchmarkRequest& request, const WorldGenConfig& config);
+
+    /**
+     * @brief Check that the world pipeline gives the same blocks regardless of scheduling
+     *
+     * Unlike the benchmark's detached runs, this goes through SimpleMinerGenerator::GenerateRegionHashes:
+     * exact heights are published and read back by neighbours' border trees, so the result depends on
+     * the scheduling if anything does.
+     * Generates the region once on one thread in row-major order and parallelPasses times on maxThreads
+     * in a seeded shuffle of the chunks (fresh generator each), and logs every chunk whose content hash
+     * differs from the single-threaded run.
+     *
+     * @return false if a run was cancelled or any chunk differs
+     */
+    static bool VerifyDeterminism(const WorldGenBenchmarkRequest& request, const WorldGenConfig& config);
+};
@@ -0,0 +1,318 @@
+#include "WorldPregenerator.hpp"
+#include "Engine/Core/Logger/LoggerAPI.hpp"
+#include "Engine/Core/Yaml.hpp"
+#include "Engine/Voxel/Chunk/Chunk.hpp"
+#include "Engine/Voxel/World/World.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace enigma::voxel;
+
+namespace
+{
+    constexpr int    MAX_RADIUS_CHUNKS = 4096;
+    constexpr double REPORT_INTERVAL_S = 5.0;
+    constexpr float  FOCUS_HEIGHT      = 128.0f; // Player Z while steering activation (not used for generation)
+    constexpr int    PROGRESS_FORMAT   = 2; // 1 also recorded the seed
+
+    double SecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // Generated chunks only reach the disk if the storage saves unmodified chunks
+    bool SavesGeneratedChunks()
+    {
+        YamlConfiguration storageConfig = YamlConfiguration::LoadFromFile(".enigma/config/engine/chunkstorage.yml");
+        std::string       saveStrategy  = storageConfig.GetString("chunk_storage.save_strategy", "ModifiedOnly");
+        if (saveStrategy != "All")
+        {
+            LogError("WorldPregenerator", "chunk_storage.save_strategy is %s; pregeneration needs All, or no generated chunk is written "
+                     "(set it in chunkstorage.yml for the run)", saveStrategy.c_str());
+            return false;
+        }
+        return true;
+    }
+}
+
+CommandLineRequest WorldPregenerator::ParseCommandLine(const char* commandLine, PregenerationRequest& outRequest)
+{
+    if (!commandLine)
+    {
+        return CommandLineRequest::NotRequested;
+    }
+
+    std::istringstream tokens(commandLine);
+    std::string        token;
+    bool               requested = false;
+    bool               hasRadius = false;
+    while (tokens >> token)
+    {
+        if (token == "-pregen" || token == "--pregen")
+        {
+            requested = true;
+            continue;
+        }
+
+        size_t separator = token.find('=');
+        if (!requested || separator == std::string::npos)
+        {
+            continue;
+        }
+        std::string key   = token.substr(0, separator);
+        std::string value = token.substr(separator + 1);
+        char*       end   = nullptr;
+        if (key == "seed")
+        {
+            // A different seed would leave seams against the chunks a normal launch generates into the same save
+            LogError("WorldPregenerator", "Pregeneration uses the world's seed; remove 'seed=%s'", value.c_str());
+            return CommandLineRequest::Invalid;
+        }
+        else if (key == "center")
+        {
+            int x = 0, y = 0;
+            if (std::sscanf(value.c_str(), "%d,%d", &x, &y) != 2)
+            {
+                LogError("WorldPregenerator", "Invalid pregeneration centre '%s' (expected chunkX,chunkY)", value.c_str());
+                return CommandLineRequest::Invalid;
+            }
+            outRequest.centerChunk = IntVec2(x, y);
+        }
+        else if (key == "radius")
+        {
+            outRequest.radiusChunks = static_cast<int>(std::strtol(value.c_str(), &end, 10));
+            hasRadius               = end && *end == '\0' && !value.empty();
+        }
+        else if (key == "progress")
+        {
+            outRequest.progressPath = value;
+        }
+        else
+        {
+            LogWarn("WorldPregenerator", "Unknown pregeneration option '%s'", key.c_str());
+        }
+    }
+
+    if (!requested)
+    {
+        return CommandLineRequest::NotRequested;
+    }
+    if (!hasRadius || outRequest.radiusChunks < 0 || outRequest.radiusChunks > MAX_RADIUS_CHUNKS)
+    {
+        LogError("WorldPregenerator", "Usage: -pregen center=<chunkX>,<chunkY> radius=<0-%d> [progress=<file>] "
+                 "(needs chunk_storage.save_strategy: All in chunkstorage.yml)", MAX_RADIUS_CHUNKS);
+        return CommandLineRequest::Invalid;
+    }
+    return SavesGeneratedChunks() ? CommandLineRequest::Valid : CommandLineRequest::Invalid;
+}
+
+WorldPregenerator::WorldPregenerator(const PregenerationRequest& request, int activationRangeChunks)
+    : m_request(request)
+      , m_activationRange(activationRangeChunks)
+{
+    // Largest square centred on the focus chunk that the (circular) activation range fully covers
+    m_tileHalfSize = (std::max)(0, static_cast<int>(std::floor((m_activationRange - 1) / std::sqrt(2.0))));
+
+    int side      = 2 * m_request.radiusChunks + 1;
+    m_totalChunks = static_cast<int64_t>(side) * side;
+    PlanTiles();
+    LoadProgress();
+
+    m_sessionStartChunks = m_completedChunks;
+    m_sessionStart       = std::chrono::steady_clock::now();
+    m_lastReport         = m_sessionStart;
+
+    // Checked again here: tiles are only marked done once SaveWorld() has written them
+    m_savesGeneratedChunks = SavesGeneratedChunks();
+
+    LogInfo("WorldPregenerator", "Pregenerating %lld chunks around (%d, %d), radius %d: %zu tiles of %dx%d%s",
+            static_cast<long long>(m_totalChunks), m_request.centerChunk.x, m_request.centerChunk.y, m_request.radiusChunks,
+            m_tiles.size(), 2 * m_tileHalfSize + 1, 2 * m_tileHalfSize + 1,
+            m_nextTile > 0 ? " (resumed)" : "");
+}
+
+void WorldPregenerator::PlanTiles()
+{
+    int tileSide  = 2 * m_tileHalfSize + 1;
+    int tileReach = (m_request.radiusChunks + m_tileHalfSize) / tileSide; // Tiles from the centre tile to the edge
+
+    m_tiles.clear();
+    for (int tileY = -tileReach; tileY <= tileReach; ++tileY)
+    {
+        for (int tileX = -tileReach; tileX <= tileReach; ++tileX)
+        {
+            m_tiles.emplace_back(m_request.centerChunk.x + tileX * tileSide, m_request.centerChunk.y + tileY * tileSide);
+        }
+    }
+
+    // Centre outwards (ring by ring), so an interrupted run still leaves a usable spawn area
+    const IntVec2 center = m_request.centerChunk;
+    std::stable_sort(m_tiles.begin(), m_tiles.end(), [center](const IntVec2& a, const IntVec2& b)
+    {
+        int ringA = (std::max)(std::abs(a.x - center.x), std::abs(a.y - center.y));
+        int ringB = (std::max)(std::abs(b.x - center.x), std::abs(b.y - center.y));
+        return ringA < ringB;
+    });
+}
+
+int WorldPregenerator::CountTileChunks(const IntVec2& tileCenter) const
+{
+    const IntVec2 center = m_request.centerChunk;
+    const int     radius = m_request.radiusChunks;
+    int           minX   = (std::max)(tileCenter.x - m_tileHalfSize, center.x - radius);
+    int           maxX   = (std::min)(tileCenter.x + m_tileHalfSize, center.x + radius);
+    int           minY   = (std::max)(tileCenter.y - m_tileHalfSize, center.y - radius);
+    int           maxY   = (std::min)(tileCenter.y + m_tileHalfSize, center.y + radius);
+    return (maxX >= minX && maxY >= minY) ? (maxX - minX + 1) * (maxY - minY + 1) : 0;
+}
+
+int WorldPregenerator::CountGeneratedChunks(World& world, const IntVec2& tileCenter) const
+{
+    const IntVec2 center    = m_request.centerChunk;
+    const int     radius    = m_request.radiusChunks;
+    int           generated = 0;
+    for (int chunkY = (std::max)(tileCenter.y - m_tileHalfSize, center.y - radius);
+         chunkY <= (std::min)(tileCenter.y + m_tileHalfSize, center.y + radius); ++chunkY)
+    {
+        for (int chunkX = (std::max)(tileCenter.x - m_tileHalfSize, center.x - radius);
+             chunkX <= (std::min)(tileCenter.x + m_tileHalfSize, center.x + radius); ++chunkX)
+        {
+            Chunk* chunk = world.GetChunk(chunkX, chunkY);
+            if (chunk && chunk->IsGenerated())
+            {
+                ++generated;
+            }
+        }
+    }
+    return generated;
+}
+
+bool WorldPregenerator::Update(World& world)
+{
+    if (IsFinished())
+    {
+        return true;
+    }
+    if (!m_savesGeneratedChunks)
+    {
+        // Nothing would be persisted; stop without touching the progress file
+        LogError("WorldPregenerator", "Pregeneration stopped: chunks are not saved with this chunk storage configuration");
+        return true;
+    }
+
+    const IntVec2& tile      = m_tiles[m_nextTile];
+    int            generated = CountGeneratedChunks(world, tile);
+    if (generated < CountTileChunks(tile))
+    {
+        if (SecondsSince(m_lastReport) >= REPORT_INTERVAL_S)
+        {
+            LogProgress(generated);
+        }
+        return false;
+    }
+
+    // Flush the tile through the world's storage before the focus moves on (and it may unload)
+    world.SaveWorld();
+    m_completedChunks += CountTileChunks(tile);
+    ++m_nextTile;
+    SaveProgress();
+
+    if (IsFinished())
+    {
+        double elapsed = SecondsSince(m_sessionStart);
+        LogInfo("WorldPregenerator", "Pregeneration complete: %lld chunks in %.1f s (%.1f chunks/s this run)",
+                static_cast<long long>(m_totalChunks), elapsed,
+                elapsed > 0.0 ? static_cast<double>(m_completedChunks - m_sessionStartChunks) / elapsed : 0.0);
+        return true;
+    }
+    if (SecondsSince(m_lastReport) >= REPORT_INTERVAL_S)
+    {
+        LogProgress(0);
+    }
+    return false;
+}
+
+Vec3 WorldPregenerator::GetFocusPosition() const
+{
+    const IntVec2& tile = IsFinished() ? m_request.centerChunk : m_tiles[m_nextTile];
+    return Vec3((static_cast<float>(tile.x) + 0.5f) * static_cast<float>(Chunk::CHUNK_SIZE_X),
+                (static_cast<float>(tile.y) + 0.5f) * static_cast<float>(Chunk::CHUNK_SIZE_Y), FOCUS_HEIGHT);
+}
+
+void WorldPregenerator::LogProgress(int currentTileGenerated)
+{
+    m_lastReport = std::chrono::steady_clock::now();
+
+    double  elapsed   = SecondsSince(m_sessionStart);
+    int64_t done      = m_completedChunks + currentTileGenerated;
+    double  rate      = elapsed > 0.0 ? static_cast<double>(done - m_sessionStartChunks) / elapsed : 0.0;
+    double  remaining = rate > 0.0 ? static_cast<double>(m_totalChunks - done) / rate : 0.0;
+    LogInfo("WorldPregenerator", "Pregeneration %lld / %lld chunks (%.1f%%), tile %zu / %zu, %.1f chunks/s, ETA %d:%02d",
+            static_cast<long long>(done), static_cast<long long>(m_totalChunks),
+            m_totalChunks > 0 ? 100.0 * static_cast<double>(done) / static_cast<double>(m_totalChunks) : 100.0,
+            m_nextTile + 1, m_tiles.size(), rate, static_cast<int>(remaining) / 60, static_cast<int>(remaining) % 60);
+}
+
+void WorldPregenerator::LoadProgress()
+{
+    std::ifstream file(m_request.progressPath);
+    if (!file)
+    {
+        return;
+    }
+
+    int    format    = 0, centerX = 0, centerY = 0, radius = 0, activationRange = 0;
+    size_t tilesDone = 0;
+    if (!(file >> format >> centerX >> centerY >> radius >> activationRange >> tilesDone) || format != PROGRESS_FORMAT)
+    {
+        LogWarn("WorldPregenerator", "Ignoring unreadable progress file %s", m_request.progressPath.c_str());
+        return;
+    }
+
+    // The tile plan depends on every one of these, so only an identical run can resume
+    if (centerX != m_request.centerChunk.x || centerY != m_request.centerChunk.y ||
+        radius != m_request.radiusChunks || activationRange != m_activationRange)
+    {
+        LogWarn("WorldPregenerator", "Progress file %s belongs to a different run, starting over", m_request.progressPath.c_str());
+        return;
+    }
+
+    m_nextTile = (std::min)(tilesDone, m_tiles.size());
+    for (size_t tile = 0; tile < m_nextTile; ++tile)
+    {
+        m_completedChunks += CountTileChunks(m_tiles[tile]);
+    }
+}
+
+void WorldPregenerator::SaveProgress() const
+{
+    std::error_code       error;
+    std::filesystem::path path(m_request.progressPath);
+    if (path.has_parent_path())
+    {
+        std::filesystem::create_directories(path.parent_path(), error);
+    }
+
+    // Written next to the file and renamed, so an interruption never leaves a truncated record
+    std::string   temporaryPath = m_request.progressPath + ".tmp";
+    std::ofstream file(temporaryPath, std::ios::trunc);
+    if (!file)
+    {
+        LogWarn("WorldPregenerator", "Cannot write progress file %s", temporaryPath.c_str());
+        return;
+    }
+    file << PROGRESS_FORMAT << ' ' << m_request.centerChunk.x << ' ' << m_request.centerChunk.y << ' '
+        << m_request.radiusChunks << ' ' << m_activationRange << ' ' << m_nextTile << '\n';
+    file.close();
+
+    std::filesystem::rename(temporaryPath, path, error);
+    if (error)
+    {
+        LogWarn("WorldPregenerator", "Cannot replace progress file %s: %s", m_request.progressPath.c_str(), error.message().c_str());
+    }
+}
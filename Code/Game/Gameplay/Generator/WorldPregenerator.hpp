@@ -0,0 +1,91 @@
+#pragma once
+#include "CommandLineRequest.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace enigma::voxel
+{
+    class World;
+}
+
+/**
+ * @brief Parameters of a pregeneration run (command line: -pregen center=<chunkX>,<chunkY> radius=<chunks>)
+ *
+ * There is no seed: the run generates into the "world" save with the same seeds as a normal launch,
+ * so pregenerated chunks line up with the ones generated while playing.
+ *
+ * Set chunk_storage.save_strategy to All in .enigma/config/engine/chunkstorage.yml for the run (the
+ * shipped value saves modified chunks only); with any other value -pregen is rejected and the app quits.
+ */
+struct PregenerationRequest
+{
+    IntVec2     centerChunk  = IntVec2(0, 0);
+    int         radiusChunks = 0; // Square of (2 * radius + 1)^2 chunks around the centre
+    std::string progressPath = ".enigma/saves/pregen.progress";
+};
+
+/**
+ * @brief Pregenerates a square of chunks by steering the world's chunk activation across it
+ *
+ * The world keeps generating on its ChunkGen workers (all cores per schedule.yml) and writes
+ * through its configured ESF / ESFS storage on SaveWorld(). The region is split into tiles that
+ * fit inside the activation range; the focus moves tile by tile from the centre outwards, and a
+ * tile is saved once all of its chunks are generated.
+ *
+ * Completed tiles are recorded in the progress file, so an interrupted run with the same request
+ * and activation range resumes at the first unfinished tile.
+ *
+ * Requires chunk_storage.save_strategy: All (chunkstorage.yml); with any other strategy SaveWorld()
+ * skips unmodified chunks, so the run is refused and no tile is ever recorded as done.
+ */
+class WorldPregenerator
+{
+public:
+    /**
+     * @brief Parse "-pregen center=x,y radius=..." from the command line
+     * @return Invalid if it is malformed or the chunk storage would not save generated chunks (logged)
+     */
+    static CommandLineRequest ParseCommandLine(const char* commandLine, PregenerationRequest& outRequest);
+
+    WorldPregenerator(const PregenerationRequest& request, int activationRangeChunks);
+
+    /**
+     * @brief Check the current tile after World::Update, save and advance when it is complete
+     * @return true once every tile is generated and saved, or at once if chunks cannot be saved
+     */
+    bool Update(enigma::voxel::World& world);
+
+    bool IsFinished() const { return m_nextTile >= m_tiles.size(); }
+
+    /**
+     * @brief World position the player (activation centre) should be at this frame
+     */
+    Vec3 GetFocusPosition() const;
+
+private:
+    void PlanTiles();
+    int  CountGeneratedChunks(enigma::voxel::World& world, const IntVec2& tileCenter) const;
+    int  CountTileChunks(const IntVec2& tileCenter) const; // Chunks of the tile inside the requested square
+    void LoadProgress();
+    void SaveProgress() const;
+    void LogProgress(int currentTileGenerated);
+
+    PregenerationRequest m_request;
+    int                  m_activationRange      = 0;
+    bool                 m_savesGeneratedChunks = false; // chunk_storage.save_strategy is All
+    int                  m_tileHalfSize         = 0; // Tile is (2 * half + 1)^2 chunks, inside the activation range
+
+    std::vector<IntVec2> m_tiles; // Tile centres (chunk coordinates), centre first
+    size_t               m_nextTile = 0;
+
+    int64_t m_totalChunks        = 0;
+    int64_t m_completedChunks    = 0; // In finished tiles, including resumed ones
+    int64_t m_sessionStartChunks = 0; // m_completedChunks when this run started
+
+    std::chrono::steady_clock::time_point m_sessionStart;
+    std::chrono::steady_clock::time_point m_lastReport;
+};
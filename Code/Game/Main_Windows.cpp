@@ -79,7 +79,6 @@ void   CreateConsole()
 int WINAPI WinMain(HINSTANCE applicationInstanceHandle, HINSTANCE, LPSTR commandLineString, int)
 {
     UNUSED(applicationInstanceHandle)
-    UNUSED(commandLineString)
 
 #ifdef CONSOLE_HANDLER
     // Temporary Console, in SD-4 will draw by opengl
@@ -87,7 +86,7 @@ int WINAPI WinMain(HINSTANCE applicationInstanceHandle, HINSTANCE, LPSTR command
 #endif
 
     g_theApp = new App();
-    g_theApp->Startup();
+    g_theApp->Startup(commandLineString); // e.g. "-pregen center=0,0 radius=64"
 
     // Program main loop; keep running frames until it's time to quit
     while (!g_theApp->IsQuitting()) // #SD1ToDo: ...becomes:  !g_theApp->IsQuitting()
@@ -101,8 +100,9 @@ int WINAPI WinMain(HINSTANCE applicationInstanceHandle, HINSTANCE, LPSTR command
     }
 
     g_theApp->Shutdown();
+    int exitCode = g_theApp->GetExitCode();
     delete g_theApp;
     g_theApp = nullptr;
 
-    return 0;
+    return exitCode;
 }